@@ -4,6 +4,7 @@
 #include "Utils.h"
 #include "Menu.h"
 #include "Draw.h"
+#include "Profile.h"
 #include <LittleFS.h>
 #include <nvs.h>
 #include <nvs_flash.h>
@@ -68,7 +69,7 @@ static void drawAboutSystem(uint8_t arrow)
   char text[100];
   sprintf(
     text,
-    "CPU: %s r%i, %lu MHz",
+    "CPU: %s r%i, %" PRIu32 " MHz",
     ESP.getChipModel(),
     ESP.getChipRevision(),
     ESP.getCpuFreqMHz()
@@ -77,7 +78,7 @@ static void drawAboutSystem(uint8_t arrow)
 
   sprintf(
     text,
-    "FLASH: %luM, %luk (%luk), FS %luk (%luk)",
+    "FLASH: %" PRIu32 "M, %" PRIu32 "k (%" PRIu32 "k), FS %luk (%luk)",
     ESP.getFlashChipSize() / (1024U * 1024U),
     ESP.getFreeSketchSpace() / 1024U,
     (ESP.getFreeSketchSpace() - ESP.getSketchSize()) / 1024U,
@@ -90,7 +91,7 @@ static void drawAboutSystem(uint8_t arrow)
   nvs_get_stats(STORAGE_PARTITION, &nvs_stats);
   sprintf(
     text,
-    "NVS: TOTAL %u, USED %u, FREE %u",
+    "NVS: TOTAL %zu, USED %zu, FREE %zu",
     nvs_stats.total_entries,
     nvs_stats.used_entries,
     nvs_stats.free_entries
@@ -99,7 +100,7 @@ static void drawAboutSystem(uint8_t arrow)
 
   sprintf(
     text,
-    "MEM: HEAP %luk (%luk), PSRAM %luk (%luk)",
+    "MEM: HEAP %" PRIu32 "k (%" PRIu32 "k), PSRAM %" PRIu32 "k (%" PRIu32 "k)",
     ESP.getHeapSize()/1024U, ESP.getFreeHeap()/1024U,
     ESP.getPsramSize()/1024U, ESP.getFreePsram()/1024U
   );
@@ -149,6 +150,8 @@ static void drawAboutAuthors(uint8_t arrow)
 //
 void drawAbout()
 {
+  PROFILE(PROF_ABOUT);
+
   switch(doAbout(0))
   {
     case 0: drawAboutHelp(1); break;
@@ -1,6 +1,7 @@
 #include "Common.h"
 #include "Themes.h"
 #include "Utils.h"
+#include "Profile.h"
 
 #define VBAT_MON  4                 // GPIO04 -- Battery Monitor PIN
 
@@ -10,6 +11,8 @@
 #define BATT_SOC_LEVEL2      3.780  // Battery SOC voltage for 50%
 #define BATT_SOC_LEVEL3      3.880  // Battery SOC voltage for 75%
 #define BATT_SOC_HYST_2      0.020  // Battery SOC hyteresis voltage divided by 2
+#define BATT_CHECK_TIME       1000  // Battery voltage measurement period (ms)
+#define BATT_CHARGE_VOLTS    4.300  // Voltage above which USB power is assumed
 
 // State machine used for battery state of charge (SOC) detection with
 // hysteresis (Default = Illegal state)
@@ -37,31 +40,70 @@ float batteryMonitor()
   // 25 to 50           1
   // 50 to 75           2
   // 75 to 100          3
-  switch(batteryState)
+  //
+  // The state moves one step per measurement, so the first
+  // measurement runs it until it settles on the actual level
+  bool settle = batteryState > 3;
+  uint8_t oldState;
+
+  do
   {
-    case 0:
-      if      (batteryVolts > (BATT_SOC_LEVEL1 + BATT_SOC_HYST_2)) batteryState = 1;   // State 0 > 1
-      break;
-    case 1:
-      if      (batteryVolts > (BATT_SOC_LEVEL2 + BATT_SOC_HYST_2)) batteryState = 2;   // State 1 > 2
-      else if (batteryVolts < (BATT_SOC_LEVEL1 - BATT_SOC_HYST_2)) batteryState = 0;   // State 1 > 0
-      break;
-    case 2:
-      if      (batteryVolts > (BATT_SOC_LEVEL3 + BATT_SOC_HYST_2)) batteryState = 3;   // State 2 > 3
-      else if (batteryVolts < (BATT_SOC_LEVEL2 - BATT_SOC_HYST_2)) batteryState = 1;   // State 2 > 1
-      break;
-    case 3:
-      if      (batteryVolts < (BATT_SOC_LEVEL3 - BATT_SOC_HYST_2)) batteryState = 2;   // State 3 > 2
-      break;
-    default:
-      if      (batteryState > 3) batteryState = 0;                                // State (Illegal) > 0
-      break;
+    oldState = batteryState;
+    switch(batteryState)
+    {
+      case 0:
+        if      (batteryVolts > (BATT_SOC_LEVEL1 + BATT_SOC_HYST_2)) batteryState = 1;   // State 0 > 1
+        break;
+      case 1:
+        if      (batteryVolts > (BATT_SOC_LEVEL2 + BATT_SOC_HYST_2)) batteryState = 2;   // State 1 > 2
+        else if (batteryVolts < (BATT_SOC_LEVEL1 - BATT_SOC_HYST_2)) batteryState = 0;   // State 1 > 0
+        break;
+      case 2:
+        if      (batteryVolts > (BATT_SOC_LEVEL3 + BATT_SOC_HYST_2)) batteryState = 3;   // State 2 > 3
+        else if (batteryVolts < (BATT_SOC_LEVEL2 - BATT_SOC_HYST_2)) batteryState = 1;   // State 2 > 1
+        break;
+      case 3:
+        if      (batteryVolts < (BATT_SOC_LEVEL3 - BATT_SOC_HYST_2)) batteryState = 2;   // State 3 > 2
+        break;
+      default:
+        if      (batteryState > 3) batteryState = 0;                                // State (Illegal) > 0
+        break;
+    }
   }
+  while(settle && (oldState != batteryState));
 
   // Return current voltage
   return(batteryVolts);
 }
 
+//
+// Return last measured battery voltage
+//
+float batteryVoltage()
+{
+  return(batteryVolts);
+}
+
+//
+// Periodically measure battery voltage, return true if the
+// displayed battery status has changed and needs redrawing
+//
+bool batteryTickTime()
+{
+  static uint32_t checkTime = 0;
+
+  // Measure right away if the state is not known yet
+  if((batteryState <= 3) && ((millis() - checkTime) < BATT_CHECK_TIME)) return(false);
+  checkTime = millis();
+
+  uint8_t oldState = batteryState;
+  bool oldCharging = batteryVolts > BATT_CHARGE_VOLTS;
+
+  batteryMonitor();
+
+  return((oldState != batteryState) || (oldCharging != (batteryVolts > BATT_CHARGE_VOLTS)));
+}
+
 //
 // Show last measured battery voltage and status at given screen
 // coordinates. Return true if voltage was drawn.
@@ -70,8 +112,11 @@ bool drawBattery(int x, int y)
 {
   if(sleepOn()) return false;
 
-  // Measure battery voltage and status
-  batteryMonitor();
+  PROFILE(PROF_BATTERY);
+
+  // Drawing only uses the last measured values, see batteryTickTime()
+  uint8_t state = batteryState;
+  float volts = batteryVolts;
 
   // Set display information
   spr.drawRoundRect(x, y + 1, 28, 14, 3, TH.batt_border);
@@ -84,14 +129,14 @@ bool drawBattery(int x, int y)
   if(switchThemeEditor())
   {
     // Alternate between five battery states every 10 seconds
-    batteryState = (millis() % 50000u) / 10000u;
-    batteryVolts = batteryState >= 4 ? 4.5 : 4.0;
+    state = (millis() % 50000u) / 10000u;
+    volts = state >= 4 ? 4.5 : 4.0;
   }
 
   // The hardware has a load sharing circuit to allow simultaneous charge and power
   // With USB(5V) connected the voltage reading will be approx. VBUS - Diode Drop = 4.65V
   // If the average voltage is greater than 4.3V, show ligtning on the display
-  if(batteryVolts > 4.3)
+  if(volts > BATT_CHARGE_VOLTS)
   {
     spr.fillRoundRect(x + 2, y + 3, 24, 10, 2, TH.batt_charge);
     spr.drawLine(x + 9 + 8, y + 1, x + 9 + 6, y + 1 + 5, TH.bg);
@@ -113,10 +158,10 @@ bool drawBattery(int x, int y)
     int level;
 
     // Text representation of the voltage
-    sprintf(voltage, "%.02fV", batteryVolts);
+    sprintf(voltage, "%.02fV", volts);
 
     // Battery bar color and width
-    switch(batteryState)
+    switch(state)
     {
       case 0:
         color = TH.batt_low;
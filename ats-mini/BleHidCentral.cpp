@@ -176,8 +176,27 @@ bool BleHidCentral::tryMatchVol20(
   return true;
 }
 
+void BleHidCentral::dropStaleInput()
+{
+  if (!inputStale) return;
+  inputStale = false;
+  reports.clear();
+  pendingState = {};
+  virtualPushUntil = 0;
+  playPauseClickDeadline = 0;
+  playPausePressedAt = 0;
+  ignoreNextPlayPauseRelease = false;
+  pressedMask_ = 0;
+}
+
 BleHidState BleHidCentral::update()
 {
+  dropStaleInput();
+
+  InputReport report;
+  while (reports.pop(&report))
+    applyInputReport(report);
+
   if (!pendingState.rotation && !pendingState.wasClicked && !pendingState.wasShortPressed &&
       playPauseClickDeadline && (int32_t)(millis() - playPauseClickDeadline) >= 0)
   {
@@ -196,10 +215,13 @@ BleHidState BleHidCentral::update()
 
 bool BleHidCentral::consumeAbortPending()
 {
+  dropStaleInput();
+
   bool pending = abortPending;
   abortPending = false;
   if (pending)
   {
+    reports.clear();
     pendingState = {};
     virtualPushUntil = 0;
     playPauseClickDeadline = 0;
@@ -286,15 +308,11 @@ bool BleHidCentral::setupConnectedPeer()
 
 void BleHidCentral::resetConnectedPeerState()
 {
-  pendingState = {};
+  // Runs in the NimBLE task, the main loop owns the input state
+  inputStale = true;
   abortPending = false;
   clearReportBinding();
-  virtualPushUntil = 0;
-  playPauseClickDeadline = 0;
-  playPausePressedAt = 0;
-  ignoreNextPlayPauseRelease = false;
   supportsDoubleClick_ = true;
-  pressedMask_ = 0;
   if (activeInstance == this)
     activeInstance = nullptr;
 }
@@ -377,14 +395,34 @@ void BleHidCentral::handleInputReport(BLERemoteCharacteristic* characteristic, c
   }
 
   if (!decoded) return;
+
+  // Runs in the NimBLE task: the report is applied by the main loop
+  InputReport report;
+  report.keys =
+    (hasScanNext ? ScanNextPressed : 0) |
+    (hasScanPrevious ? ScanPreviousPressed : 0) |
+    (hasVolumeIncrement ? VolumeIncrementPressed : 0) |
+    (hasVolumeDecrement ? VolumeDecrementPressed : 0) |
+    (hasPlayPause ? PlayPausePressed : 0);
+  report.time = millis();
+  reports.push(report);
   abortPending = true;
+}
+
+void BleHidCentral::applyInputReport(const InputReport& report)
+{
+  bool hasScanNext = !!(report.keys & ScanNextPressed);
+  bool hasScanPrevious = !!(report.keys & ScanPreviousPressed);
+  bool hasVolumeIncrement = !!(report.keys & VolumeIncrementPressed);
+  bool hasVolumeDecrement = !!(report.keys & VolumeDecrementPressed);
+  bool hasPlayPause = !!(report.keys & PlayPausePressed);
 
   bool volumeIncrementPressed = !!(pressedMask_ & VolumeIncrementPressed);
   bool volumeDecrementPressed = !!(pressedMask_ & VolumeDecrementPressed);
   bool scanNextPressed = !!(pressedMask_ & ScanNextPressed);
   bool scanPreviousPressed = !!(pressedMask_ & ScanPreviousPressed);
   bool playPausePressed = !!(pressedMask_ & PlayPausePressed);
-  uint32_t now = millis();
+  uint32_t now = report.time;
   bool isReleaseReport =
     !hasScanNext &&
     !hasScanPrevious &&
@@ -406,7 +444,7 @@ void BleHidCentral::handleInputReport(BLERemoteCharacteristic* characteristic, c
     pendingState.rotation++;
     if (playPausePressed)
     {
-      holdVirtualPush();
+      holdVirtualPush(now);
       ignoreNextPlayPauseRelease = true;
     }
   }
@@ -416,7 +454,7 @@ void BleHidCentral::handleInputReport(BLERemoteCharacteristic* characteristic, c
     pendingState.rotation--;
     if (playPausePressed)
     {
-      holdVirtualPush();
+      holdVirtualPush(now);
       ignoreNextPlayPauseRelease = true;
     }
   }
@@ -424,13 +462,13 @@ void BleHidCentral::handleInputReport(BLERemoteCharacteristic* characteristic, c
   if (hasScanNext && !scanNextPressed && pendingState.rotation < 32767)
   {
     pendingState.rotation++;
-    holdVirtualPush();
+    holdVirtualPush(now);
   }
 
   if (hasScanPrevious && !scanPreviousPressed && pendingState.rotation > -32768)
   {
     pendingState.rotation--;
-    holdVirtualPush();
+    holdVirtualPush(now);
   }
 
   if (isReleaseReport && playPausePressed)
@@ -487,7 +525,7 @@ void BleHidCentral::handleInputReport(BLERemoteCharacteristic* characteristic, c
   setPressed(PlayPausePressed, hasPlayPause);
 }
 
-void BleHidCentral::holdVirtualPush()
+void BleHidCentral::holdVirtualPush(uint32_t now)
 {
-  virtualPushUntil = millis() + virtualPushHoldMs;
+  virtualPushUntil = now + virtualPushHoldMs;
 }
@@ -2,9 +2,11 @@
 #define BLE_HID_CENTRAL_H
 
 #include "BleCentral.h"
+#include "TaskQueue.h"
 
 #define BLE_SCAN_INTERVAL 100
 #define BLE_SCAN_WINDOW 100
+#define BLE_HID_QUEUE_SIZE 16
 
 struct BleHidState {
   bool isPressed = false;
@@ -44,6 +46,12 @@ private:
     PlayPausePressed = 1 << 4,
   };
 
+  // Decoded report, queued by the NimBLE task for the main loop
+  struct InputReport {
+    uint8_t keys;   // PressBit mask
+    uint32_t time;  // millis() on arrival
+  };
+
   static constexpr uint32_t virtualPushHoldMs = 150;
   static constexpr uint32_t playPauseDoubleClickMs = 400;
   static constexpr uint32_t keyboardPressMinMs = 50;
@@ -65,10 +73,15 @@ private:
   bool subscribeToInputReport(BLEClient& client, uint16_t reportHandle);
   void clearReportBinding();
   void handleInputReport(BLERemoteCharacteristic* characteristic, const uint8_t* data, size_t length);
-  void holdVirtualPush();
+  void applyInputReport(const InputReport& report);
+  void holdVirtualPush(uint32_t now);
+  void dropStaleInput();
 
+  TaskQueue<InputReport, BLE_HID_QUEUE_SIZE> reports;
   BleHidState pendingState{};
   volatile bool abortPending = false;
+  // Set on disconnect, the main loop then drops the peer's input
+  volatile bool inputStale = false;
   DecoderKind decoder_ = DecoderKind::None;
   uint16_t reportHandle_ = 0;
   uint32_t virtualPushUntil = 0;
@@ -1,6 +1,7 @@
 #include "Common.h"
 #include "Themes.h"
 #include "Remote.h"
+#include "RemoteBinary.h"
 #include "Draw.h"
 #include "BleHidCentral.h"
 #include "BleMode.h"
@@ -8,6 +9,7 @@
 static BleUartPeripheral BLESerial;
 static BleHidCentral BLEHid;
 static RemoteState remoteBLEState;
+static BinaryState binaryBLEState;
 
 static void bleControllerDisable()
 {
@@ -69,6 +71,7 @@ void bleInit(uint8_t bleMode)
   switch(bleMode)
   {
     case BLE_ADHOC:
+    case BLE_BINARY:
       BLESerial.begin(RECEIVER_NAME);
       break;
     case BLE_HID:
@@ -79,14 +82,25 @@ void bleInit(uint8_t bleMode)
 
 int bleLoop(uint8_t bleMode)
 {
+  // Ad hoc commands are executed by remoteLoop(), one session per connection
+  if (bleMode == BLE_ADHOC && BLESerial.isConnected())
+    remoteOpen(&BLESerial, &remoteBLEState);
+  else
+    remoteClose(&remoteBLEState);
+
   if (bleMode == BLE_ADHOC)
-  {
-    if (BLESerial.isConnected())
-      remoteTickTime(&BLESerial, &remoteBLEState);
-    if (!BLESerial.isConnected()) return 0;
-    if (BLESerial.available())
-      return remoteDoCommand(&BLESerial, &remoteBLEState, BLESerial.read());
     return 0;
+
+  if (bleMode == BLE_BINARY)
+  {
+    if (!BLESerial.isConnected())
+    {
+      // Next client has to subscribe again
+      binaryBLEState.binaryTlmMask = 0;
+      return 0;
+    }
+    binaryTickTime(&BLESerial, &binaryBLEState);
+    return binaryReceive(&BLESerial, &binaryBLEState);
   }
 
   if (bleMode != BLE_HID)
@@ -129,3 +143,11 @@ bool bleConsumeAbortPending(uint8_t bleMode)
 
   return false;
 }
+
+uint16_t bleSamplePeriod(uint8_t bleMode)
+{
+  if (bleMode == BLE_BINARY && BLESerial.isConnected())
+    return binarySamplePeriod(&binaryBLEState);
+
+  return 0;
+}
@@ -9,5 +9,6 @@ void bleStop();
 int8_t getBleStatus();
 int bleLoop(uint8_t bleMode);
 bool bleConsumeAbortPending(uint8_t bleMode);
+uint16_t bleSamplePeriod(uint8_t bleMode);
 
 #endif
@@ -7,10 +7,17 @@ bool BleUartPeripheral::consumeAbortPending()
   bool pending = abortPending;
   abortPending = false;
   if (pending)
-    rxBuf.flush();
+    rxBuf.clear();
   return pending;
 }
 
+void BleUartPeripheral::dropStaleInput()
+{
+  if (!rxStale) return;
+  rxStale = false;
+  rxBuf.clear();
+}
+
 bool BleUartPeripheral::canSend() const
 {
   return (txCh != nullptr) &&
@@ -127,7 +134,8 @@ void BleUartPeripheral::destroyServices()
 {
   resetTxSession();
   abortPending = false;
-  rxBuf.flush();
+  rxStale = false;
+  rxBuf.clear();
 }
 
 void BleUartPeripheral::configureAdvertising(BLEAdvertising& advertising)
@@ -150,7 +158,7 @@ void BleUartPeripheral::onDisconnect(BLEServer* server, ble_gap_conn_desc* desc)
   if (desc->conn_handle == txConnHandle)
     resetTxSession();
 
-  rxBuf.flush();
+  rxStale = true;
   BlePeripheral::onDisconnect(server, desc);
 }
 
@@ -161,11 +169,8 @@ void BleUartPeripheral::onWrite(BLECharacteristic* characteristic, ble_gap_conn_
   uint8_t* data = characteristic->getData();
   size_t byteCount = characteristic->getLength();
   abortPending |= byteCount > 0;
-  size_t room = rxBuf.room();
-  if (byteCount > room)
-    byteCount = room;
   if ((data != nullptr) && (byteCount > 0))
-    rxBuf.write((const char*)data, byteCount);
+    rxBuf.push(data, byteCount);
 }
 
 void BleUartPeripheral::onSubscribe(BLECharacteristic* characteristic, ble_gap_conn_desc* desc, uint16_t subValue)
@@ -240,21 +245,25 @@ void BleUartPeripheral::onStatus(BLECharacteristic* characteristic, Status statu
 int BleUartPeripheral::available()
 {
   pumpTx();
+  dropStaleInput();
   return rxBuf.available();
 }
 
 int BleUartPeripheral::peek()
 {
   pumpTx();
-  return rxBuf.peek();
+  dropStaleInput();
+  return rxBuf.empty() ? -1 : *rxBuf.front();
 }
 
 int BleUartPeripheral::read()
 {
   pumpTx();
-  int value = rxBuf.read();
-  if (value >= 0)
-    abortPending = false;
+  dropStaleInput();
+  uint8_t value;
+  if (!rxBuf.pop(&value))
+    return -1;
+  abortPending = false;
   return value;
 }
 
@@ -302,6 +311,14 @@ size_t BleUartPeripheral::write(const uint8_t* data, size_t size)
   return writtenByteCount;
 }
 
+int BleUartPeripheral::availableForWrite()
+{
+  if ((txCh == nullptr) || !canSend()) return 0;
+
+  pumpTx();
+  return txBuf.room();
+}
+
 size_t BleUartPeripheral::write(uint8_t byte)
 {
   return write(&byte, 1);
@@ -3,6 +3,7 @@
 
 #include <cbuf.h>
 #include "BlePeripheral.h"
+#include "TaskQueue.h"
 
 #define UART_SERVICE_UUID           "6E400001-B5A3-F393-E0A9-E50E24DCCA9E"
 #define UART_CHARACTERISTIC_UUID_RX "6E400002-B5A3-F393-E0A9-E50E24DCCA9E"
@@ -35,6 +36,7 @@ public:
 
   size_t write(uint8_t byte) override;
   size_t write(const uint8_t* data, size_t size) override;
+  int availableForWrite() override;
   using Print::write;
 
   size_t print(std::string str);
@@ -59,14 +61,18 @@ private:
   size_t pumpTx();
   void clearPendingTx();
   void resetTxSession();
+  void dropStaleInput();
 
   BLEService* service = nullptr;
   BLECharacteristic* txCh = nullptr;
   BLECharacteristic* rxCh = nullptr;
 
-  cbuf rxBuf{BLE_BUFFER_SIZE};
+  // Written by the NimBLE task, read by the main loop
+  TaskQueue<uint8_t, BLE_BUFFER_SIZE> rxBuf;
   cbuf txBuf{BLE_BUFFER_SIZE};
   volatile bool abortPending = false;
+  // Set on disconnect, the main loop then drops the peer's input
+  volatile bool rxStale = false;
   // Flat notify payload assembled from txBuf, even when the ring wraps.
   uint8_t txChunk[BLE_MAX_MTU - 3];
   // Bytes currently retained for notify/retry outside txBuf.
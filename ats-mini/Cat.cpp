@@ -0,0 +1,133 @@
+#include "Common.h"
+#include "Utils.h"
+#include "Menu.h"
+#include "Remote.h"
+#include "Telemetry.h"
+#include "Cat.h"
+
+// Kenwood mode numbers, indexed by FM, LSB, USB, AM
+static const uint8_t catModes[] = { 4, 1, 2, 5 };
+
+static uint32_t catGetFrequency()
+{
+  // BFO is only used in SSB modes and is zero otherwise
+  return(freqToHz(currentFrequency, currentMode) + currentBFO);
+}
+
+//
+// Change to the given mode by stepping doMode(), which keeps
+// the per-band mode rules. FM is only available on FM bands.
+//
+static bool catSetMode(uint8_t mode)
+{
+  if(mode == currentMode) return(true);
+  if(mode == FM || currentMode == FM) return(false);
+
+  for(int i=0 ; (i < getTotalModes()) && (currentMode != mode) ; i++)
+    doMode(1);
+
+  return(currentMode == mode);
+}
+
+//
+// Convert RSSI to the 0-30 S-meter scale (S9 = 15)
+//
+static int catGetSMeter()
+{
+  int s = getStrength(telemetryGet()->rssi) - 1;
+  return(s <= 9 ? s * 15 / 9 : 15 + (s - 9) * 15 / 7);
+}
+
+//
+// Execute a complete command (without the ';'). Queries are
+// answered from the current state and never touch the hardware.
+//
+static int catDoCommand(Stream* stream, const char *cmd)
+{
+  const char *arg = cmd + 2;
+  int event = 0;
+
+  if(!strcmp(cmd, "ID"))
+    stream->print("ID019;");
+  else if(!strcmp(cmd, "PS"))
+    stream->print("PS1;");
+  else if(!strcmp(cmd, "AI"))
+    stream->print("AI0;");
+  else if(!strcmp(cmd, "FR") || !strcmp(cmd, "FT"))
+    stream->printf("%s0;", cmd);
+  else if(!strcmp(cmd, "FA") || !strcmp(cmd, "FB"))
+    stream->printf("%s%011lu;", cmd, (unsigned long)catGetFrequency());
+  else if(!strcmp(cmd, "MD"))
+    stream->printf("MD%u;", catModes[currentMode]);
+  else if(!strcmp(cmd, "SM") || !strcmp(cmd, "SM0"))
+    stream->printf("SM0%04d;", catGetSMeter());
+  else if(!strcmp(cmd, "IF"))
+  {
+    // Frequency, step, RIT offset, RIT/XIT, memory channel, RX,
+    // mode, VFO A, no scan, no split, no tone, no shift
+    stream->printf("IF%011lu     +0000000000%u0000000;",
+                   (unsigned long)catGetFrequency(), catModes[currentMode]);
+  }
+  else if(!strncmp(cmd, "FA", 2) && (strlen(arg) == 11) && (strspn(arg, "0123456789") == 11))
+  {
+    if(remoteTuneFrequency(atol(arg))) stream->print("?;");
+    else event = REMOTE_CHANGED | REMOTE_PREFS;
+  }
+  else if(!strncmp(cmd, "MD", 2) && (strlen(arg) == 1))
+  {
+    int mode = -1;
+    for(int i=0 ; i<getTotalModes() ; i++)
+      if(catModes[i] == arg[0] - '0') mode = i;
+
+    if((mode < 0) || !catSetMode(mode)) stream->print("?;");
+    else event = REMOTE_CHANGED | REMOTE_PREFS;
+  }
+  else if(!strcmp(cmd, "AI0") || !strcmp(cmd, "PS1") || !strcmp(cmd, "FR0") || !strcmp(cmd, "FT0"))
+  {
+    // Accept settings matching the only supported state
+  }
+  else
+    stream->print("?;");
+
+  return(event);
+}
+
+//
+// Receive available CAT input without blocking. Commands end with
+// ';' and are accumulated across calls, at most one command is
+// executed per call.
+//
+int catReceive(Stream* stream, CatState* state)
+{
+  while(stream->available())
+  {
+    char ch = stream->read();
+
+    // Ignore line breaks some programs add
+    if((ch == '\r') || (ch == '\n') || (ch == ' ')) continue;
+
+    if(ch != ';')
+    {
+      if(state->catLineLen >= CAT_LINE_SIZE - 1)
+        state->catOverflow = true;
+      else
+        state->catLine[state->catLineLen++] = toupper(ch);
+      continue;
+    }
+
+    state->catLine[state->catLineLen] = '\0';
+    bool overflow = state->catOverflow;
+    state->catLineLen  = 0;
+    state->catOverflow = false;
+
+    if(overflow)
+    {
+      stream->print("?;");
+      return(0);
+    }
+
+    return(catDoCommand(stream, state->catLine));
+  }
+
+  return(0);
+}
@@ -0,0 +1,19 @@
+#ifndef CAT_H
+#define CAT_H
+
+//
+// Kenwood TS-2000 compatible CAT protocol subset, understood by
+// Hamlib (rigctl model 2014) and most logging software
+//
+
+#define CAT_LINE_SIZE 32  // Maximum command length
+
+typedef struct {
+  bool catOverflow = false;        // Command is too long, skipping it
+  uint8_t catLineLen = 0;          // Characters received so far
+  char catLine[CAT_LINE_SIZE];
+} CatState;
+
+int catReceive(Stream* stream, CatState* state);
+
+#endif
@@ -98,10 +98,13 @@
 #define BLE_OFF        0 // Bluetooth is disabled
 #define BLE_ADHOC      1 // Ad hoc BLE serial protocol
 #define BLE_HID        2 // BLE HID central
+#define BLE_BINARY     3 // Binary BLE serial protocol
 
 // USB modes
 #define USB_OFF        0 // USB is disabled
 #define USB_ADHOC      1 // Ad hoc serial protocol
+#define USB_BINARY     2 // Binary serial protocol
+#define USB_CAT        3 // Kenwood compatible CAT protocol
 
 //
 // Data Types
@@ -208,10 +211,13 @@ bool consumeAbortPending();
 
 // Battery.c
 float batteryMonitor();
+float batteryVoltage();
+bool batteryTickTime();
 bool drawBattery(int x, int y);
 
 // Scan.c
 void scanRun(uint16_t centerFreq, uint16_t step);
+void scanStream(uint16_t startFreq, uint16_t step, uint16_t count, bool (*point)(uint16_t freq, uint8_t rssi, uint8_t snr));
 float scanGetRSSI(uint16_t freq);
 float scanGetSNR(uint16_t freq);
 
@@ -227,14 +233,17 @@ bool identifyFrequency(uint16_t freq, bool periodic = false);
 
 // Network.cpp
 int8_t getWiFiStatus();
+uint8_t getWiFiProgress();
+bool getWiFiMessage(const char **line1, const char **line2);
 char *getWiFiIPAddress();
 void netInit(uint8_t netMode, bool showStatus = true);
 void netStop();
 bool ntpIsAvailable();
-bool ntpSyncTime();
 
 void netRequestConnect();
-void netTickTime();
+bool netTickTime();
+int webLoop();
+void webStateChanged();
 
 // Remote.c
 #define REMOTE_CHANGED   1
@@ -3,14 +3,64 @@
 #include "Storage.h"
 #include "Utils.h"
 #include "Menu.h"
+#include "Remote.h"
 #include "BleMode.h"
 #include "Draw.h"
+#include "Profile.h"
+
+#define FRAME_TIME             33  // Minimum time between frames (ms), ~30fps
+#define BACKGROUND_FRAME_TIME 250  // Minimum time between background-only frames (ms)
+
+static uint8_t drawPending = 0;    // Pending REDRAW_* requests
+static uint32_t drawTime = 0;      // Time the last frame has been drawn
+static uint32_t drawFrames = 0;    // Number of frames drawn into the sprite
+
+//
+// Request screen redraw with given priority, requests are merged
+// until the next frame is drawn by drawTickTime()
+//
+void drawRequest(uint8_t priority)
+{
+  drawPending |= priority;
+}
+
+//
+// Draw pending screen update, limiting the frame rate.
+// Return true if the screen has been drawn.
+//
+bool drawTickTime()
+{
+  if(!drawPending) return(false);
+
+  // Hold background changes while a screenshot is being sent,
+  // user input is still shown at once
+  if(!(drawPending & REDRAW_INPUT) && remoteCapturing()) return(false);
+
+  // Input changes are shown at the full frame rate, while
+  // background changes are drawn less often
+  uint32_t frameTime = drawPending & REDRAW_INPUT? FRAME_TIME : BACKGROUND_FRAME_TIME;
+  if((millis() - drawTime) < frameTime) return(false);
+
+  drawScreen();
+  return(true);
+}
+
+//
+// Return number of frames drawn so far, changes every time
+// the sprite contents may have changed
+//
+uint32_t drawFrameCount()
+{
+  return(drawFrames);
+}
 
 //
 // Draw preferences write indicator
 //
 void drawSaveIndicator(int x, int y)
 {
+  PROFILE(PROF_SAVE_ICON);
+
   if(prefsAreWritten() || switchThemeEditor())
   {
     // Draw preferences write request icon
@@ -27,6 +77,8 @@ void drawSaveIndicator(int x, int y)
 //
 void drawBleIndicator(int x, int y)
 {
+  PROFILE(PROF_BLE_ICON);
+
   int8_t status = getBleStatus();
 
   // If need to draw BLE icon...
@@ -51,10 +103,13 @@ void drawBleIndicator(int x, int y)
 //
 void drawWiFiIndicator(int x, int y)
 {
+  PROFILE(PROF_WIFI_ICON);
+
   int8_t status = getWiFiStatus();
+  uint8_t progress = getWiFiProgress();
 
   // If need to draw WiFi icon...
-  if(status || switchThemeEditor())
+  if(status || progress || switchThemeEditor())
   {
     uint16_t color = (status>0) ? TH.rf_icon_conn : TH.rf_icon;
 
@@ -62,9 +117,10 @@ void drawWiFiIndicator(int x, int y)
     if(switchThemeEditor())
       color = millis()&0x2000? TH.rf_icon_conn : TH.rf_icon;
 
-    spr.drawSmoothArc(x, 15+y, 14, 13, 150, 210, color, TH.bg);
-    spr.drawSmoothArc(x, 15+y, 9, 8, 150, 210, color, TH.bg);
-    spr.drawSmoothArc(x, 15+y, 4, 3, 150, 210, color, TH.bg);
+    // While connecting, light up the arcs one by one from the inside
+    spr.drawSmoothArc(x, 15+y, 14, 13, 150, 210, progress? (progress>2? TH.rf_icon_conn : TH.rf_icon) : color, TH.bg);
+    spr.drawSmoothArc(x, 15+y, 9, 8, 150, 210, progress? (progress>1? TH.rf_icon_conn : TH.rf_icon) : color, TH.bg);
+    spr.drawSmoothArc(x, 15+y, 4, 3, 150, 210, progress? TH.rf_icon_conn : color, TH.bg);
   }
 }
 
@@ -73,6 +129,8 @@ void drawWiFiIndicator(int x, int y)
 //
 bool drawWiFiStatus(const char *statusLine1, const char *statusLine2, int x, int y)
 {
+  PROFILE(PROF_WIFI_STATUS);
+
   if(statusLine1 || statusLine2)
   {
     // Draw two lines of network status
@@ -93,6 +151,8 @@ void drawZoomedMenu(const char *text, bool force)
 {
   if (!zoomMenu && !force) return;
 
+  PROFILE(PROF_ZOOMED_MENU);
+
   spr.fillSmoothRoundRect(RDS_OFFSET_X - 72 + 1, RDS_OFFSET_Y - 3 + 1, 152, 26, 4, TH.menu_bg);
   spr.setTextDatum(TC_DATUM);
   spr.setTextColor(TH.menu_item);
@@ -107,6 +167,7 @@ void drawMessage(const char *msg)
 {
   if(sleepOn()) return;
 
+  drawFrames++;
   drawZoomedMenu(msg, true);
   spr.pushSprite(0, 0);
 }
@@ -116,6 +177,8 @@ void drawMessage(const char *msg)
 //
 void drawBandAndMode(const char *band, const char *mode, int x, int y)
 {
+  PROFILE(PROF_BAND_MODE);
+
   spr.setTextDatum(TC_DATUM);
   spr.setTextColor(TH.band_text);
   uint16_t band_width = spr.drawString(band, x, y);
@@ -132,6 +195,8 @@ void drawBandAndMode(const char *band, const char *mode, int x, int y)
 //
 void drawRadioText(int y, int ymax)
 {
+  PROFILE(PROF_RADIO_TEXT);
+
   const char *rt = getRadioText();
 
   // Draw potentially multi-line radio text
@@ -150,6 +215,8 @@ void drawRadioText(int y, int ymax)
 //
 void drawFrequency(uint32_t freq, int x, int y, int ux, int uy, uint8_t hl)
 {
+  PROFILE(PROF_FREQUENCY);
+
   struct Line { int x, y, w; };
 
   const Line hlDigitsFM[] =
@@ -215,10 +282,10 @@ void drawFrequency(uint32_t freq, int x, int y, int ux, int uy, uint8_t hl)
       // SSB frequency
       char text[32];
       freq = freq * 1000 + currentBFO;
-      sprintf(text, "%3.3lu", freq / 1000);
+      sprintf(text, "%3.3" PRIu32, freq / 1000);
       spr.drawString(text, x, y, 7);
       spr.setTextDatum(ML_DATUM);
-      sprintf(text, ".%3.3lu", freq % 1000);
+      sprintf(text, ".%3.3" PRIu32, freq % 1000);
       spr.drawString(text, 4+x, 17+y, 4);
     }
     else
@@ -255,6 +322,8 @@ void drawFrequency(uint32_t freq, int x, int y, int ux, int uy, uint8_t hl)
 //
 void drawScale(uint32_t freq)
 {
+  PROFILE(PROF_SCALE);
+
   // Scale pointer
   spr.fillTriangle(156, 120, 160, 130, 164, 120, TH.scale_pointer);
   spr.drawLine(160, 130, 160, 169, TH.scale_pointer);
@@ -314,6 +383,8 @@ void drawScale(uint32_t freq)
 //
 void drawSMeter(int strength, int x, int y)
 {
+  PROFILE(PROF_SMETER);
+
   spr.drawTriangle(x + 1, y + 1, x + 11, y + 1, x + 6, y + 6, TH.smeter_icon);
   spr.drawLine(x + 6, y + 1, x + 6, y + 14, TH.smeter_icon);
 
@@ -331,6 +402,8 @@ void drawSMeter(int strength, int x, int y)
 //
 void drawStereoIndicator(int x, int y, bool stereo)
 {
+  PROFILE(PROF_STEREO);
+
   if(stereo)
   {
     // Split S-meter into two rows
@@ -344,6 +417,8 @@ void drawStereoIndicator(int x, int y, bool stereo)
 //
 void drawStationName(const char *name, int x, int y)
 {
+  PROFILE(PROF_STATION_NAME);
+
   spr.setTextDatum(TC_DATUM);
   spr.setTextColor(TH.rds_text);
   spr.drawString(name, x, y, 4);
@@ -354,6 +429,8 @@ void drawStationName(const char *name, int x, int y)
 //
 void drawLongStationName(const char *name, int x, int y)
 {
+  PROFILE(PROF_STATION_NAME);
+
   int width = spr.textWidth(name, 2);
   spr.setTextColor(TH.rds_text);
 
@@ -379,6 +456,8 @@ void drawLongStationName(const char *name, int x, int y)
 //
 void drawScanGraphs(uint32_t freq)
 {
+  PROFILE(PROF_SCAN_GRAPHS);
+
   // Scale offset
   int16_t offset = (freq % 10) / 10.0 * 8;
 
@@ -429,11 +508,22 @@ void drawScanGraphs(uint32_t freq)
 //
 void drawScreen(const char *statusLine1, const char *statusLine2)
 {
+  // Any drawn frame satisfies all pending requests
+  drawPending = 0;
+  drawTime = millis();
+
   if(sleepOn()) return;
 
+  PROFILE(PROF_SCREEN);
+
+  drawFrames++;
+
   // Clear screen buffer
   spr.fillSprite(TH.bg);
 
+  // Show network status message, if any, unless given other status
+  if(!statusLine1 && !statusLine2) getWiFiMessage(&statusLine1, &statusLine2);
+
   // About screen is a special case
   if(currentCmd==CMD_ABOUT)
   {
@@ -451,5 +541,6 @@ void drawScreen(const char *statusLine1, const char *statusLine2)
       break;
   }
 
+  PROFILE(PROF_PUSH);
   spr.pushSprite(0, 0);
 }
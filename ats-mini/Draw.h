@@ -32,6 +32,14 @@
 #define BLE_OFFSET_X   104    // BLE x offset
 #define BLE_OFFSET_Y     0    // BLE y offset
 
+// Screen redraw request priorities
+#define REDRAW_BACKGROUND 1   // Meters, clock, battery, periodic refresh
+#define REDRAW_INPUT      2   // Encoder, button, and remote commands
+
+void drawRequest(uint8_t priority);
+bool drawTickTime();
+uint32_t drawFrameCount();
+
 void drawMessage(const char *msg);
 void drawZoomedMenu(const char *text, bool force = false);
 void drawScanGraphs(uint32_t freq);
@@ -0,0 +1,173 @@
+#include "Json.h"
+#include <string.h>
+#include <stdlib.h>
+#include <ctype.h>
+
+static void jsonSkip(char **p)
+{
+  while(**p && isspace((unsigned char)**p)) (*p)++;
+}
+
+static int jsonHex(char c)
+{
+  if(c >= '0' && c <= '9') return(c - '0');
+  if(c >= 'a' && c <= 'f') return(c - 'a' + 10);
+  if(c >= 'A' && c <= 'F') return(c - 'A' + 10);
+  return(-1);
+}
+
+//
+// Unescape a string starting at the opening quote, return the
+// string or NULL if it is malformed
+//
+static char *jsonString(char **p)
+{
+  if(**p != '"') return(NULL);
+
+  char *start = ++(*p);
+  char *out = start;
+
+  while(**p != '"')
+  {
+    char c = *(*p)++;
+
+    if(!c || ((unsigned char)c < ' ')) return(NULL);
+    if(c != '\\')
+    {
+      *out++ = c;
+      continue;
+    }
+
+    switch(c = *(*p)++)
+    {
+      case '"': case '\\': case '/': *out++ = c; break;
+      case 'b': *out++ = '\b'; break;
+      case 'f': *out++ = '\f'; break;
+      case 'n': *out++ = '\n'; break;
+      case 'r': *out++ = '\r'; break;
+      case 't': *out++ = '\t'; break;
+      case 'u':
+      {
+        int code = 0;
+        for(int j=0 ; j<4 ; j++)
+        {
+          int digit = jsonHex(*(*p)++);
+          if(digit < 0) return(NULL);
+          code = (code << 4) | digit;
+        }
+        // Only ASCII is meaningful to the receiver
+        *out++ = code && code < 0x80 ? code : '?';
+        break;
+      }
+      default:
+        return(NULL);
+    }
+  }
+
+  // Terminate in place, output never runs ahead of input
+  (*p)++;
+  *out = '\0';
+  return(start);
+}
+
+static bool jsonValue(char **p, JsonField *field)
+{
+  field->str = NULL;
+  field->num = 0;
+
+  if(**p == '"')
+  {
+    field->type = JSON_STRING;
+    field->str  = jsonString(p);
+    return(field->str != NULL);
+  }
+
+  if((**p == '-') || isdigit((unsigned char)**p))
+  {
+    char *end;
+    field->type = JSON_NUMBER;
+    field->num  = strtol(*p, &end, 10);
+    if(end == *p || (*end == '.') || (*end == 'e') || (*end == 'E')) return(false);
+    *p = end;
+    return(true);
+  }
+
+  static const struct { const char *word; uint8_t type; long num; } words[] =
+  {
+    { "true", JSON_BOOL, 1 }, { "false", JSON_BOOL, 0 }, { "null", JSON_NULL, 0 }
+  };
+
+  for(size_t j=0 ; j<sizeof(words)/sizeof(words[0]) ; j++)
+  {
+    size_t len = strlen(words[j].word);
+    if(strncmp(*p, words[j].word, len)) continue;
+    field->type = words[j].type;
+    field->num  = words[j].num;
+    *p += len;
+    return(true);
+  }
+
+  return(false);
+}
+
+int jsonParse(char *text, JsonField *fields, int maxFields)
+{
+  char *p = text;
+  int count = 0;
+
+  jsonSkip(&p);
+  if(*p++ != '{') return(-1);
+  jsonSkip(&p);
+
+  if(*p == '}')
+  {
+    p++;
+  }
+  else
+  {
+    for(;;)
+    {
+      if(count >= maxFields) return(-1);
+
+      // Key string, value may not overwrite the terminator
+      char *key = jsonString(&p);
+      if(!key) return(-1);
+      jsonSkip(&p);
+      if(*p++ != ':') return(-1);
+      jsonSkip(&p);
+
+      fields[count].key = key;
+      if(!jsonValue(&p, &fields[count])) return(-1);
+      count++;
+
+      jsonSkip(&p);
+      if(*p == ',') { p++; jsonSkip(&p); continue; }
+      if(*p++ == '}') break;
+      return(-1);
+    }
+  }
+
+  jsonSkip(&p);
+  return(*p ? -1 : count);
+}
+
+const JsonField *jsonGet(const JsonField *fields, int count, const char *key, uint8_t type)
+{
+  for(int j=0 ; j<count ; j++)
+    if(!strcmp(fields[j].key, key))
+      return(fields[j].type == type ? &fields[j] : NULL);
+
+  return(NULL);
+}
+
+bool jsonOnly(const JsonField *fields, int count, const char *const *keys)
+{
+  for(int j=0 ; j<count ; j++)
+  {
+    int k;
+    for(k=0 ; keys[k] && strcmp(fields[j].key, keys[k]) ; k++);
+    if(!keys[k]) return(false);
+  }
+
+  return(true);
+}
@@ -0,0 +1,37 @@
+#ifndef JSON_H
+#define JSON_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+//
+// Minimal JSON reader for flat objects of strings, integers,
+// booleans, and nulls, as sent to the web API. Parsing is done in
+// place: keys and strings are unescaped and terminated inside the
+// parsed text, nothing is allocated.
+//
+
+#define JSON_NULL    0
+#define JSON_BOOL    1
+#define JSON_NUMBER  2
+#define JSON_STRING  3
+
+typedef struct
+{
+  const char *key;
+  uint8_t type;            // JSON_*
+  const char *str;         // String value
+  long num;                // Number or boolean value
+} JsonField;
+
+// Parse a flat object, return the number of fields or -1 if the
+// text is not a flat object or has more than maxFields fields
+int jsonParse(char *text, JsonField *fields, int maxFields);
+
+// Find a field of the given type, NULL if missing
+const JsonField *jsonGet(const JsonField *fields, int count, const char *key, uint8_t type);
+
+// Return true if all fields are of the listed keys (NULL terminated)
+bool jsonOnly(const JsonField *fields, int count, const char *const *keys);
+
+#endif
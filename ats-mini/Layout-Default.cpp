@@ -3,9 +3,13 @@
 #include "Utils.h"
 #include "Menu.h"
 #include "Draw.h"
+#include "Profile.h"
+#include "Telemetry.h"
 
 void drawLayoutDefault(const char *statusLine1, const char *statusLine2)
 {
+  PROFILE(PROF_LAYOUT_DEFAULT);
+
   // Draw preferences write request icon
   drawSaveIndicator(SAVE_OFFSET_X, SAVE_OFFSET_Y);
 
@@ -57,7 +61,7 @@ void drawLayoutDefault(const char *statusLine1, const char *statusLine2)
   drawSMeter(getStrength(rssi), METER_OFFSET_X, METER_OFFSET_Y);
 
   // Indicate FM pilot detection (stereo indicator)
-  drawStereoIndicator(METER_OFFSET_X, METER_OFFSET_Y, (currentMode==FM) && rx.getCurrentPilot());
+  drawStereoIndicator(METER_OFFSET_X, METER_OFFSET_Y, (currentMode==FM) && telemetryGet()->pilot);
 
   if(currentCmd == CMD_SCAN)
   {
@@ -2,6 +2,8 @@
 #include "Themes.h"
 #include "Menu.h"
 #include "Draw.h"
+#include "Profile.h"
+#include "Telemetry.h"
 
 static int getInterpolatedStrength(int rssi)
 {
@@ -47,6 +49,8 @@ static int getInterpolatedStrength(int rssi)
 //
 static void drawSmallScale(uint32_t freq, int y)
 {
+  PROFILE(PROF_SCALE);
+
   const Band *band = getCurrentBand();
   const uint16_t scaleStart = 51;
   const uint16_t scaleEnd = 269;
@@ -76,6 +80,8 @@ static void drawSmallScale(uint32_t freq, int y)
 //
 static void drawAltStereoIndicator(int x, int y, bool stereo = true)
 {
+  PROFILE(PROF_STEREO);
+
   if(stereo)
   {
     spr.drawCircle(x - 4, y, 7, TH.stereo_icon);
@@ -86,6 +92,8 @@ static void drawAltStereoIndicator(int x, int y, bool stereo = true)
 
 static void drawLargeSMeter(int rssi, int strength, int x, int y)
 {
+  PROFILE(PROF_SMETER);
+
   // S-Meter legend
   spr.setTextDatum(TC_DATUM);
   spr.setTextColor(TH.scale_text);
@@ -132,6 +140,8 @@ static void drawLargeSMeter(int rssi, int strength, int x, int y)
 
 static void drawLargeSNMeter(int snr, int x, int y)
 {
+  PROFILE(PROF_SNMETER);
+
   spr.setTextColor(TH.scale_text);
   spr.setTextDatum(BL_DATUM);
   spr.drawString("N", x - 10, 12 + y, 2);
@@ -152,6 +162,8 @@ static void drawLargeSNMeter(int snr, int x, int y)
 //
 void drawLayoutSmeter(const char *statusLine1, const char *statusLine2)
 {
+  PROFILE(PROF_LAYOUT_SMETER);
+
   // Draw preferences write request icon
   drawSaveIndicator(SAVE_OFFSET_X, SAVE_OFFSET_Y);
 
@@ -203,7 +215,7 @@ void drawLayoutSmeter(const char *statusLine1, const char *statusLine2)
   drawSideBar(currentCmd, ALT_MENU_OFFSET_X, ALT_MENU_OFFSET_Y, MENU_DELTA_X);
 
   // Indicate FM pilot detection (stereo indicator)
-  drawAltStereoIndicator(ALT_STEREO_OFFSET_X, ALT_STEREO_OFFSET_Y, (currentMode==FM) && rx.getCurrentPilot());
+  drawAltStereoIndicator(ALT_STEREO_OFFSET_X, ALT_STEREO_OFFSET_Y, (currentMode==FM) && telemetryGet()->pilot);
 
   if(currentCmd == CMD_SCAN)
   {
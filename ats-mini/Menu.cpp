@@ -6,6 +6,7 @@
 #include "EIBI.h"
 #include "BleMode.h"
 #include "Menu.h"
+#include "Profile.h"
 
 //
 // Bands Menu
@@ -273,7 +274,7 @@ static const char *uiLayoutDesc[] =
 
 uint8_t usbModeIdx = USB_OFF;
 static const char *usbModeDesc[] =
-{ "Off", "Ad hoc" };
+{ "Off", "Ad hoc", "Binary", "CAT" };
 
 int getTotalUSBModes() { return(ITEM_COUNT(usbModeDesc)); }
 
@@ -283,7 +284,7 @@ int getTotalUSBModes() { return(ITEM_COUNT(usbModeDesc)); }
 
 uint8_t bleModeIdx = BLE_OFF;
 static const char *bleModeDesc[] =
-{ "Off", "Ad hoc", "HID" };
+{ "Off", "Ad hoc", "HID", "Binary" };
 
 int getTotalBleModes() { return(ITEM_COUNT(bleModeDesc)); }
 
@@ -351,6 +352,16 @@ static int getLastStep(int mode)
   return(0);
 }
 
+const Step *getStep(uint8_t mode, uint8_t idx)
+{
+  return(mode < ITEM_COUNT(steps) && idx <= getLastStep(mode) ? &steps[mode][idx] : NULL);
+}
+
+uint8_t getDefaultStepIdx(uint8_t mode)
+{
+  return(defaultStepIdx[mode]);
+}
+
 const Step *getCurrentStep()
 {
   uint8_t idx = bands[bandIdx].currentStepIdx > getLastStep(currentMode) ? defaultStepIdx[currentMode] : bands[bandIdx].currentStepIdx;
@@ -445,6 +456,16 @@ static int getLastBandwidth(int mode)
   return(0);
 }
 
+const Bandwidth *getBandwidth(uint8_t mode, uint8_t idx)
+{
+  return(mode < ITEM_COUNT(bandwidths) && idx <= getLastBandwidth(mode) ? &bandwidths[mode][idx] : NULL);
+}
+
+uint8_t getDefaultBandwidthIdx(uint8_t mode)
+{
+  return(defaultBwIdx[mode]);
+}
+
 const Bandwidth *getCurrentBandwidth()
 {
   return(&bandwidths[currentMode][bands[bandIdx].bandwidthIdx > getLastBandwidth(currentMode) ? defaultBwIdx[currentMode] : bands[bandIdx].bandwidthIdx]);
@@ -792,15 +813,24 @@ void doMode(int16_t enc)
   if(currentMode==FM) return;
 
   // Change AM/LSB/USB modes, do not allow FM mode
+  uint8_t mode = currentMode;
   do
-    currentMode = wrap_range(currentMode, enc, 0, LAST_ITEM(bandModeDesc));
-  while(currentMode==FM);
+    mode = wrap_range(mode, enc, 0, LAST_ITEM(bandModeDesc));
+  while(mode==FM);
 
+  selectMode(mode);
+}
+
+//
+// Switch current band to the given mode
+//
+void selectMode(uint8_t mode)
+{
   // Save current band settings
   bands[bandIdx].currentFreq = currentFrequency + currentBFO / 1000;
-  bands[bandIdx].currentStepIdx = defaultStepIdx[currentMode];
-  bands[bandIdx].bandwidthIdx = defaultBwIdx[currentMode];
-  bands[bandIdx].bandMode = currentMode;
+  bands[bandIdx].currentStepIdx = defaultStepIdx[mode];
+  bands[bandIdx].bandwidthIdx = defaultBwIdx[mode];
+  bands[bandIdx].bandMode = currentMode = mode;
 
   // Enable the new band
   selectBand(bandIdx);
@@ -1428,7 +1458,7 @@ static void drawMemory(int x, int y, int sx)
     else if(memories[j].mode==FM)
       sprintf(buf, "%3.2f %s", memories[j].freq / 1000000.0, bandModeDesc[memories[j].mode]);
     else
-      sprintf(buf, "%5lu %s", memories[j].freq / 1000, bandModeDesc[memories[j].mode]);
+      sprintf(buf, "%5" PRIu32 " %s", memories[j].freq / 1000, bandModeDesc[memories[j].mode]);
 
     if(i==0) {
       drawZoomedMenu(text);
@@ -1702,6 +1732,8 @@ void drawSideBar(uint16_t cmd, int x, int y, int sx)
 {
   if(sleepOn()) return;
 
+  PROFILE(PROF_SIDEBAR);
+
   switch(cmd)
   {
     case CMD_MENU:       drawMenu(x, y, sx);       break;
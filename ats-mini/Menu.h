@@ -106,6 +106,7 @@ bool doSideBar(uint16_t cmd, int16_t enc, int16_t enca);
 void doSelectDigit(int16_t enc);
 bool clickHandler(uint16_t cmd, bool shortPress);
 void selectBand(uint8_t idx, bool drawLoadingSSB = true);
+bool tuneToMemory(const Memory *memory);
 int getTotalBands();
 int getTotalModes();
 int getTotalMemories();
@@ -114,6 +115,10 @@ uint8_t getFreqInputPos();
 int getFreqInputStep();
 const Step *getCurrentStep();
 const Bandwidth *getCurrentBandwidth();
+const Step *getStep(uint8_t mode, uint8_t idx);
+const Bandwidth *getBandwidth(uint8_t mode, uint8_t idx);
+uint8_t getDefaultStepIdx(uint8_t mode);
+uint8_t getDefaultBandwidthIdx(uint8_t mode);
 uint8_t getRDSMode();
 
 int getCurrentUTCOffset();
@@ -131,6 +136,7 @@ void doBrt(int16_t enc);
 void doCal(int16_t enc);
 void doStep(int16_t enc);
 void doMode(int16_t enc);
+void selectMode(uint8_t mode);
 void doBand(int16_t enc);
 
 #endif // MENU_H
@@ -4,24 +4,50 @@
 #include "Utils.h"
 #include "Menu.h"
 #include "Draw.h"
+#include "Telemetry.h"
+#include "RemoteUdp.h"
+#include "RemoteWs.h"
+#include "Script.h"
+#include "WebWriter.h"
+#include "WebApi.h"
+#include "Ota.h"
+#include "TaskQueue.h"
 
 #include <WiFi.h>
-#include <WiFiMulti.h>
-#include <WiFiUdp.h>
 #include <AsyncTCP.h>
 #include <ESPAsyncWebServer.h>
-#include <NTPClient.h>
 #include <ESPmDNS.h>
+#include <esp_sntp.h>
+#include <LittleFS.h>
+
+// Static pages and the stylesheet, gzipped
+#include "WebAssets.h"
 
 #define CONNECT_TIME  3000  // Time of inactivity to start connecting WiFi
-#define WIFI_MULTI_TOTAL_TIMEOUT  30000
+
+#define MIRROR_TIME        100  // Minimum time between screen mirror updates (ms)
+#define MIRROR_TILE_W       32  // Screen mirror tile width
+#define MIRROR_TILE_H       17  // Screen mirror tile height
+#define MIRROR_MAX_TILES   100  // Maximum number of tiles (320x170 screen)
+#define MIRROR_BUF_SIZE   8192  // Maximum screen mirror message size
+#define STATUS_TIME        250  // Minimum time between live status updates (ms)
+#define WEB_QUEUE_SIZE       8  // Settings changes waiting for the main loop (power of two)
+
+#define WIFI_CONNECT_TIMEOUT 30000  // Give up connecting after this time (ms)
+#define WIFI_JOIN_TIMEOUT     5000  // Time to join one network and get an address (ms)
+#define WIFI_RETRY_TIME       1000  // Pause before scanning for networks again (ms)
+#define WIFI_LEASE_TIME    1800000  // Reuse IP address in Sync Only mode for this long (ms)
+#define WIFI_PROGRESS_TIME     400  // WiFi icon animation step while connecting (ms)
+#define WIFI_EVENT_QUEUE_SIZE    8  // WiFi events waiting for the main loop (power of two)
+#define NET_MESSAGE_TIME      3000  // Time to show network status messages (ms)
+#define NTP_SYNC_TIMEOUT     15000  // Time to wait for NTP in Sync Only mode (ms)
+#define NTP_SYNC_INTERVAL   300000  // NTP time update period (ms)
+#define WEB_VALID_TIME   1577836800  // Earlier system time means no date (2020-01-01)
 
 #ifndef WIFI_POWER_LEVEL
 #define WIFI_POWER_LEVEL WIFI_POWER_17dBm
 #endif
 
-WiFiMulti wifiMulti;
-
 //
 // Access Point (AP) mode settings
 //
@@ -31,39 +57,399 @@ static const int   apChannel = 10;      // WiFi channel number (1..13)
 static const bool  apHideMe  = false;   // TRUE: disable SSID broadcast
 static const int   apClients = 3;       // Maximum simultaneous connected clients
 
-static uint16_t ajaxInterval = 2500;
-
 static bool itIsTimeToWiFi = false; // TRUE: Need to connect to WiFi
 static uint32_t connectTime = millis();
 
+//
+// Web login, written by the main loop and read by the web server
+// task, which copies it out and retries if a write got in between
+//
+static char loginUsername[65] = "";
+static char loginPassword[65] = "";
+static volatile uint32_t loginVersion = 0;  // Odd while being written
+
+static void loginSet(const char *username, const char *password)
+{
+  loginVersion++;
+  __sync_synchronize();
+  strlcpy(loginUsername, username, sizeof(loginUsername));
+  strlcpy(loginPassword, password, sizeof(loginPassword));
+  __sync_synchronize();
+  loginVersion++;
+}
+
+static void loginGet(char *username, char *password)
+{
+  uint32_t version;
+
+  do
+  {
+    while((version = loginVersion) & 1) delay(1);
+    __sync_synchronize();
+    memcpy(username, loginUsername, sizeof(loginUsername));
+    memcpy(password, loginPassword, sizeof(loginPassword));
+    __sync_synchronize();
+  }
+  while(version != loginVersion);
+
+  username[sizeof(loginUsername) - 1] = '\0';
+  password[sizeof(loginPassword) - 1] = '\0';
+}
+
 // Settings
-String loginUsername = "";
-String loginPassword = "";
 static bool wifiScanHidden = false;
+static char wifiSSID[3][33];
+static char wifiPass[3][65];
+
+//
+// Network bring-up runs in the background, advanced by netTickTime()
+// and the WiFi events queued by wifiOnEvent()
+//
+#define NET_IDLE   0  // Not connecting: off, AP only, connected, or given up
+#define NET_SCAN   1  // Scanning for configured networks
+#define NET_JOIN   2  // Joining a network, waiting for an IP address
+#define NET_RETRY  3  // Waiting to scan again
+#define NET_NTP    4  // Connected in Sync Only mode, waiting for time
+
+typedef struct
+{
+  uint8_t net;            // Network number
+  int32_t channel;        // 0 if not seen in the scan
+  int32_t rssi;
+  uint8_t bssid[6];
+} WiFiCandidate;
+
+static uint8_t netMode = NET_OFF;
+static uint8_t netState = NET_IDLE;
+static uint32_t netStartTime = 0;   // Connection attempt start
+static uint32_t netStateTime = 0;   // Current state start
+static uint8_t netProgress = 0;     // WiFi icon animation step shown
+static WiFiCandidate wifiCandidates[3];
+static uint8_t wifiCandidateCount = 0;
+static uint8_t wifiCandidateIdx = 0;
+static TaskQueue<uint8_t, WIFI_EVENT_QUEUE_SIZE> wifiEvents;
+
+//
+// Last joined access point, saved to NVS, is joined directly
+// before falling back to scanning. The IP address lease is only
+// kept in RAM, which survives light sleep, with the time it was
+// obtained, and only reused for short Sync Only connections.
+//
+typedef struct
+{
+  char ssid[33];
+  uint8_t bssid[6];
+  uint8_t channel;
+} WiFiCache;
+
+typedef struct
+{
+  uint32_t ip;
+  uint32_t gateway;
+  uint32_t subnet;
+  uint32_t dns;
+  uint32_t time;          // Time the lease was obtained, 0 if none
+} WiFiLease;
+
+static WiFiCache wifiCache;
+static WiFiLease wifiLease;
+static bool wifiDirect = false;         // Joining the cached access point
+static bool wifiStaticIP = false;       // Using the cached IP address
+static char wifiConnectInfo[40] = "";   // Last connection time and method
+
+// Network status message shown for a while
+static bool netShowStatus = true;
+static char netMessage1[64] = "";
+static char netMessage2[64] = "";
+static uint32_t netMessageTime = 0;
+
+// TRUE once NTP time has been received, ever or since connecting
+static bool ntpTimeSet = false;
+static bool ntpSynced = false;
+
+// NTP time and when it was received, passed to ntpSyncTime()
+static int64_t ntpTime = 0;
+static uint32_t ntpTakenTime = 0;
 
 // AsyncWebServer object on port 80
 AsyncWebServer server(80);
 
-// NTP Client to get time
-WiFiUDP ntpUDP;
-NTPClient ntpClient(ntpUDP, "pool.ntp.org");
+// WebSocket streaming screen contents
+static AsyncWebSocket wsScreen("/ws/screen");
+static volatile bool mirrorReset = false;   // Resend all tiles
+
+// WebSocket streaming live status values
+static AsyncWebSocket wsStatus("/ws/status");
+static volatile bool statusReset = false;   // Resend all values
+
+// Peak heap use while serving a page (bytes)
+uint32_t webPageHeap = 0;
+
+// Receiver state shown on the pages, see webStateChanged()
+static uint32_t webBootId = 0;                  // Tells apart tags of earlier runs
+static volatile uint32_t webGeneration = 0;     // Bumped on every change
+static volatile uint32_t webModifiedTime = 0;   // Time of the last change, 0 if no date
+
+// Data shown on the web pages, copied when a page is requested
+typedef struct
+{
+  char ip[16];
+  char ssid[33];
+  const char *band;
+  uint16_t freq;
+  int16_t bfo;
+  uint8_t mode;
+  uint8_t rssi;
+  uint8_t snr;
+  float voltage;
+  uint32_t pageHeap;
+  char update[80];         // Last firmware update, empty if none
+  char wifiConnect[40];    // Last WiFi connection time, empty if none
+} WebRadioInfo;
+
+typedef struct
+{
+  Memory memories[MEMORY_COUNT];
+} WebMemoryInfo;
+
+typedef struct
+{
+  char ssid[3][33];
+  char pass[3][65];
+  char username[65];
+  char password[65];
+  char remoteKey[UDP_KEY_SIZE];
+  bool scanHidden;
+  uint8_t utcOffset;
+  uint8_t theme;
+  bool scroll;
+  bool zoom;
+} WebConfigInfo;
+
+//
+// Settings changes made on the config page. The web server task
+// only queues them, the main loop applies and saves them in webLoop()
+//
+#define WEB_SET_LOGIN      1  // User name and password
+#define WEB_SET_WIFI       2  // Network number, SSID and password
+#define WEB_SET_REMOTE_KEY 3  // UDP remote control key
+#define WEB_SET_SETTINGS   4  // Settings below, always sent last
+
+typedef struct
+{
+  uint8_t type;           // WEB_SET_*
+  uint8_t index;          // Network number
+  char name[65];          // User name, SSID, or remote key
+  char pass[65];          // Password
+  bool haveSSID;          // Some network has been configured
+  bool scanHidden;
+  int16_t utcOffset;      // -1 if unchanged
+  int16_t theme;          // -1 if unchanged
+  bool scroll;
+  bool zoom;
+} WebCommand;
+
+static TaskQueue<WebCommand, WEB_QUEUE_SIZE> webCommands;
 
 static bool wifiInitAP();
-static bool wifiConnect();
+static void wifiConnect();
+static void wifiScan();
+static bool wifiJoinCached();
+static void wifiUseLease(bool use);
+static void wifiSaveCache();
+static void wifiPickCandidates(int16_t found);
+static void wifiJoinNext();
+static void wifiConnected();
+static void wifiFailed();
+static bool wifiConnectTickTime();
+static void netServicesInit();
 static void webInit();
-static void wifiRegisterPowerLevelCallback();
+static void ntpStart();
+static bool ntpSyncTime();
+static void netSetMessage(const char *line1, const char *line2 = "");
+static void wifiRegisterCallbacks();
 static void wifiPowerLevelOnEvent(WiFiEvent_t event);
+static void wifiOnEvent(arduino_event_id_t event, arduino_event_info_t info);
 
 static void webSetConfig(AsyncWebServerRequest *request);
+static void mirrorTickTime();
+static void statusTickTime();
+
+static void webRadioInfo(WebRadioInfo *info);
+static void webConfigInfo(WebConfigInfo *info);
+//
+// Live status: browsers get a JSON object with all values first,
+// then only the values that changed, e.g. {"rssi":23,"snr":7}
+//
+typedef struct
+{
+  uint32_t freq;          // Frequency (Hz)
+  uint8_t band;
+  uint8_t mode;
+  uint8_t rssi;
+  uint8_t snr;
+  uint16_t battery;       // Battery voltage (10mV)
+} StatusValues;
+
+static uint32_t statusTime = 0;             // Last update time
+static StatusValues statusSent;             // Last sent values
+
+static void statusTickTime()
+{
+  char buf[128];
+  int len = 0;
+
+  if(!wsStatus.count() || ((millis() - statusTime) < STATUS_TIME)) return;
+  statusTime = millis();
+  wsStatus.cleanupClients();
+
+  const Telemetry *tlm = telemetryGet();
+  StatusValues now;
+  now.freq    = freqToHz(currentFrequency, currentMode) + currentBFO;
+  now.band    = bandIdx;
+  now.mode    = currentMode;
+  now.rssi    = tlm->rssi;
+  now.snr     = tlm->snr;
+  now.battery = tlm->voltage * 100 + 0.5;
+
+  // New viewers get all values
+  bool all = statusReset;
+  statusReset = false;
+
+  if(all || (now.freq != statusSent.freq))
+    len += sprintf(buf + len, ",\"frequency\":%u", (unsigned int)now.freq);
+  if(all || (now.band != statusSent.band))
+    len += sprintf(buf + len, ",\"band\":\"%s\"", bands[now.band].bandName);
+  if(all || (now.mode != statusSent.mode))
+    len += sprintf(buf + len, ",\"mode\":\"%s\"", bandModeDesc[now.mode]);
+  if(all || (now.rssi != statusSent.rssi))
+    len += sprintf(buf + len, ",\"rssi\":%d", now.rssi);
+  if(all || (now.snr != statusSent.snr))
+    len += sprintf(buf + len, ",\"snr\":%d", now.snr);
+  if(all || (now.battery != statusSent.battery))
+    len += sprintf(buf + len, ",\"battery\":%d.%02d", now.battery / 100, now.battery % 100);
+
+  if(!len) return;
+
+  // Retry on the next update if clients are busy
+  if(!wsStatus.availableForWriteAll())
+  {
+    statusReset |= all;
+    return;
+  }
+
+  buf[0] = '{';
+  buf[len++] = '}';
+  wsStatus.textAll(buf, len);
+  statusSent = now;
+}
 
-static const String webInputField(const String &name, const String &value, bool pass = false);
-static const String webStyleSheet();
-static const String webPage(const String &body);
-static const String webUtcOffsetSelector();
-static const String webThemeSelector();
-static const String webRadioPage();
-static const String webMemoryPage();
-static const String webConfigPage();
+static void webRadioInfo(WebRadioInfo *info)
+{
+  if(WiFi.status()==WL_CONNECTED)
+  {
+    strlcpy(info->ip, WiFi.localIP().toString().c_str(), sizeof(info->ip));
+    strlcpy(info->ssid, WiFi.SSID().c_str(), sizeof(info->ssid));
+  }
+  else
+  {
+    strlcpy(info->ip, WiFi.softAPIP().toString().c_str(), sizeof(info->ip));
+    strlcpy(info->ssid, apSSID, sizeof(info->ssid));
+  }
+
+  info->band     = getCurrentBand()->bandName;
+  info->freq     = currentFrequency;
+  info->bfo      = currentBFO;
+  info->mode     = currentMode;
+  info->rssi     = telemetryGet()->rssi;
+  info->snr      = telemetryGet()->snr;
+  info->voltage  = telemetryGet()->voltage;
+  info->pageHeap = webPageHeap;
+  strlcpy(info->update, otaStatus(), sizeof(info->update));
+  strlcpy(info->wifiConnect, wifiConnectInfo, sizeof(info->wifiConnect));
+}
+
+static void webConfigInfo(WebConfigInfo *info)
+{
+  // Own handle, the global prefs belongs to the main loop
+  Preferences netPrefs;
+
+  memset(info, 0, sizeof(*info));
+
+  netPrefs.begin("network", true, STORAGE_PARTITION);
+  for(int j=0 ; j<3 ; j++)
+  {
+    char name[16];
+
+    sprintf(name, "wifissid%d", j+1);
+    if(netPrefs.isKey(name)) netPrefs.getString(name, info->ssid[j], sizeof(info->ssid[j]));
+    sprintf(name, "wifipass%d", j+1);
+    if(netPrefs.isKey(name)) netPrefs.getString(name, info->pass[j], sizeof(info->pass[j]));
+  }
+  if(netPrefs.isKey("remotekey")) netPrefs.getString("remotekey", info->remoteKey, sizeof(info->remoteKey));
+  info->scanHidden = netPrefs.getBool("wifiscanhidden", false);
+  netPrefs.end();
+
+  loginGet(info->username, info->password);
+  info->utcOffset = utcOffsetIdx;
+  info->theme     = themeIdx;
+  info->scroll    = scrollDirection < 0;
+  info->zoom      = zoomMenu;
+}
+
+static void webRadioPage(WebWriter &out, const WebRadioInfo &info);
+static void webMemoryPage(WebWriter &out, const WebMemoryInfo &info);
+static void webConfigPage(WebWriter &out, const WebConfigInfo &info);
+
+//
+// Pages show the receiver state, call this when it changes
+//
+void webStateChanged()
+{
+  time_t now = time(NULL);
+
+  webModifiedTime = now>=WEB_VALID_TIME? now : 0;
+  webGeneration++;
+}
+
+//
+// Runs in the web server task
+//
+bool webNotModified(AsyncWebServerRequest *request, WebCacheTag *tag)
+{
+  time_t modified = webModifiedTime;
+  struct tm utc;
+
+  sprintf(tag->etag, "\"%08x-%u\"", (unsigned int)webBootId, (unsigned int)webGeneration);
+  tag->modified[0] = '\0';
+  if(modified)
+    strftime(tag->modified, sizeof(tag->modified), "%a, %d %b %Y %H:%M:%S GMT", gmtime_r(&modified, &utc));
+
+  // Only page loads are answered from the browser cache
+  if(request->method()!=HTTP_GET) return(false);
+
+  // Entity tag takes precedence over the date
+  if(request->hasHeader("If-None-Match"))
+  {
+    if(request->header("If-None-Match")!=tag->etag) return(false);
+  }
+  else if(!tag->modified[0] || (request->header("If-Modified-Since")!=tag->modified))
+    return(false);
+
+  AsyncWebServerResponse *response = request->beginResponse(304);
+  response->addHeader("ETag", tag->etag);
+  request->send(response);
+  return(true);
+}
+
+bool webAuthenticate(AsyncWebServerRequest *request)
+{
+  char username[sizeof(loginUsername)];
+  char password[sizeof(loginPassword)];
+
+  loginGet(username, password);
+  return(!username[0] || !password[0] || request->authenticate(username, password));
+}
 
 //
 // Delayed WiFi connection
@@ -74,8 +460,10 @@ void netRequestConnect()
   itIsTimeToWiFi = true;
 }
 
-void netTickTime()
+bool netTickTime()
 {
+  bool needRedraw = false;
+
   // Connect to WiFi if requested
   if(itIsTimeToWiFi && ((millis() - connectTime) > CONNECT_TIME))
   {
@@ -83,6 +471,30 @@ void netTickTime()
     connectTime = millis();
     itIsTimeToWiFi = false;
   }
+
+  // Pick up NTP time, then continue connecting
+  needRedraw |= ntpSyncTime();
+  needRedraw |= wifiConnectTickTime();
+
+  // Animate WiFi icon while connecting
+  if(getWiFiProgress()!=netProgress)
+  {
+    netProgress = getWiFiProgress();
+    needRedraw = true;
+  }
+
+  // Remove status message after a while
+  if(netMessage1[0] && ((millis() - netMessageTime) > NET_MESSAGE_TIME))
+  {
+    netMessage1[0] = netMessage2[0] = '\0';
+    needRedraw = true;
+  }
+
+  // Stream screen and status changes to the connected browsers
+  mirrorTickTime();
+  statusTickTime();
+
+  return(needRedraw);
 }
 
 //
@@ -108,6 +520,37 @@ int8_t getWiFiStatus()
   }
 }
 
+//
+// Get WiFi icon animation step while connecting
+// (0 - not connecting, 1..3 - number of arcs to light up)
+//
+uint8_t getWiFiProgress()
+{
+  if((netState==NET_IDLE) || (netState==NET_NTP)) return(0);
+  return((millis() - netStartTime) / WIFI_PROGRESS_TIME % 3 + 1);
+}
+
+//
+// Get network status message, FALSE if there is none
+//
+bool getWiFiMessage(const char **line1, const char **line2)
+{
+  if(!netMessage1[0]) return(false);
+
+  *line1 = netMessage1;
+  *line2 = netMessage2[0]? netMessage2 : NULL;
+  return(true);
+}
+
+static void netSetMessage(const char *line1, const char *line2)
+{
+  if(!netShowStatus) return;
+
+  strlcpy(netMessage1, line1, sizeof(netMessage1));
+  strlcpy(netMessage2, line2, sizeof(netMessage2));
+  netMessageTime = millis();
+}
+
 char *getWiFiIPAddress()
 {
   static char ip[16];
@@ -121,11 +564,20 @@ void netStop()
 {
   wifi_mode_t mode = WiFi.getMode();
 
+  // Stop connecting
+  netState = NET_IDLE;
+  if(esp_sntp_enabled()) esp_sntp_stop();
+
+  udpStop();
+  wsRemoteStop();
   MDNS.end();
 
   // If network connection up, shut it down
   if((mode==WIFI_STA) || (mode==WIFI_AP_STA))
+  {
+    WiFi.scanDelete();
     WiFi.disconnect(true);
+  }
 
   // If access point up, shut it down
   if((mode==WIFI_AP) || (mode==WIFI_AP_STA))
@@ -135,15 +587,20 @@ void netStop()
 }
 
 //
-// Initialize WiFi network and services
+// Initialize WiFi network and services. Connecting to a network
+// continues in netTickTime(), so this function returns right away
 //
-void netInit(uint8_t netMode, bool showStatus)
+void netInit(uint8_t mode, bool showStatus)
 {
   // Always disable WiFi first
   netStop();
-  wifiRegisterPowerLevelCallback();
+  wifiRegisterCallbacks();
+
+  netMode = mode;
+  netShowStatus = showStatus;
+  webStateChanged();
 
-  switch(netMode)
+  switch(mode)
   {
     case NET_OFF:
       // Do not initialize WiFi if disabled
@@ -151,14 +608,12 @@ void netInit(uint8_t netMode, bool showStatus)
     case NET_AP_ONLY:
       // Start WiFi access point if requested
       WiFi.mode(WIFI_AP);
-      // Let user see connection status if successful
-      if(wifiInitAP() && showStatus) delay(2000);
+      wifiInitAP();
       break;
     case NET_AP_CONNECT:
       // Start WiFi access point if requested
       WiFi.mode(WIFI_AP_STA);
-      // Let user see connection status if successful
-      if(wifiInitAP() && showStatus) delay(2000);
+      wifiInitAP();
       break;
     default:
       // No access point
@@ -166,37 +621,27 @@ void netInit(uint8_t netMode, bool showStatus)
       break;
   }
 
-  // Initialize WiFi and try connecting to a network
-  if(netMode>NET_AP_ONLY && wifiConnect())
-  {
-    // Let user see connection status if successful
-    if(netMode!=NET_SYNC && showStatus) delay(2000);
+  // Access point users need not wait for the network connection
+  if(mode<=NET_AP_CONNECT) netServicesInit();
 
-    // NTP time updates will happen every 5 minutes
-    ntpClient.setUpdateInterval(5*60*1000);
+  // Start connecting to a network
+  if(mode>NET_AP_ONLY) wifiConnect();
+}
 
-    // Get NTP time from the network
-    clockReset();
-    for(int j=0 ; j<10 ; j++)
-      if(ntpSyncTime()) break; else delay(500);
-  }
+//
+// Start web server, remote control, and mDNS
+//
+static void netServicesInit()
+{
+  // Initialize web server for remote configuration
+  webInit();
 
-  // If only connected to sync...
-  if(netMode==NET_SYNC)
-  {
-    // Drop network connection
-    WiFi.disconnect(true);
-    WiFi.mode(WIFI_MODE_NULL);
-  }
-  else
-  {
-    // Initialize web server for remote configuration
-    webInit();
+  // Listen for remote control datagrams
+  udpInit();
 
-    // Initialize mDNS
-    MDNS.begin("atsmini"); // Set the hostname to "atsmini.local"
-    MDNS.addService("http", "tcp", 80);
-  }
+  // Initialize mDNS
+  MDNS.begin("atsmini"); // Set the hostname to "atsmini.local"
+  MDNS.addService("http", "tcp", 80);
 }
 
 //
@@ -204,29 +649,45 @@ void netInit(uint8_t netMode, bool showStatus)
 //
 bool ntpIsAvailable()
 {
-  return(ntpClient.isTimeSet());
+  return(ntpTimeSet);
 }
 
 //
-// Update NTP time and synchronize clock with NTP time
+// Start getting NTP time in the background, updates will
+// happen every 5 minutes
 //
-bool ntpSyncTime()
+static void ntpStart()
 {
-  if(WiFi.status()==WL_CONNECTED)
-  {
-    ntpClient.update();
+  ntpSynced = false;
+  sntp_set_sync_interval(NTP_SYNC_INTERVAL);
+  configTime(0, 0, "pool.ntp.org");
+}
 
-    if(ntpClient.isTimeSet())
-      return(clockSet(
-        ntpClient.getHours(),
-        ntpClient.getMinutes(),
-        ntpClient.getSeconds()
-      ));
-  }
-  return(false);
+//
+// Runs in the lwIP task when NTP time arrives, replacing the
+// default handler, so that only the main loop sets system time
+//
+extern "C" void sntp_sync_time(struct timeval *tv)
+{
+  ntpTime = (int64_t)tv->tv_sec * 1000000 + tv->tv_usec;
+  ntpTakenTime = micros();
+  __sync_synchronize();
+  sntp_set_sync_status(SNTP_SYNC_STATUS_COMPLETED);
+}
+
+//
+// Synchronize clock with NTP time, once per received update
+//
+static bool ntpSyncTime()
+{
+  if(sntp_get_sync_status()!=SNTP_SYNC_STATUS_COMPLETED) return(false);
+
+  ntpTimeSet = ntpSynced = true;
+  __sync_synchronize();
+  return(clockSync(ntpTime + (uint32_t)(micros() - ntpTakenTime)));
 }
 
-static void wifiRegisterPowerLevelCallback()
+static void wifiRegisterCallbacks()
 {
   static bool registered = false;
 
@@ -234,6 +695,8 @@ static void wifiRegisterPowerLevelCallback()
 
   WiFi.onEvent(wifiPowerLevelOnEvent, ARDUINO_EVENT_WIFI_AP_START);
   WiFi.onEvent(wifiPowerLevelOnEvent, ARDUINO_EVENT_WIFI_STA_START);
+  WiFi.onEvent(wifiOnEvent, ARDUINO_EVENT_WIFI_STA_GOT_IP);
+  WiFi.onEvent(wifiOnEvent, ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
   registered = true;
 }
 
@@ -243,6 +706,19 @@ static void wifiPowerLevelOnEvent(WiFiEvent_t event)
   WiFi.setTxPower(WIFI_POWER_LEVEL);
 }
 
+//
+// Runs in the WiFi event task, hands events to wifiConnectTickTime()
+//
+static void wifiOnEvent(arduino_event_id_t event, arduino_event_info_t info)
+{
+  // Leaving a network to join another one is not a failure
+  if((event==ARDUINO_EVENT_WIFI_STA_DISCONNECTED) &&
+     (info.wifi_sta_disconnected.reason==WIFI_REASON_ASSOC_LEAVE))
+    return;
+
+  wifiEvents.push(event);
+}
+
 //
 // Initialize WiFi access point (AP)
 //
@@ -257,86 +733,336 @@ static bool wifiInitAP()
   WiFi.softAP(apSSID, apPWD, apChannel, apHideMe, apClients);
   WiFi.softAPConfig(ip, gateway, subnet);
 
-  drawScreen(
+  netSetMessage(
     ("Use Access Point " + String(apSSID)).c_str(),
     ("IP : " + WiFi.softAPIP().toString() + " or atsmini.local").c_str()
   );
 
-  ajaxInterval = 2500;
   return(true);
 }
 
 //
-// Connect to a WiFi network
+// Start connecting to a WiFi network
 //
-static bool wifiConnect()
+static void wifiConnect()
 {
-  String status = "Connecting to WiFi network...";
-
-  // Clean credentials
-  wifiMulti.APlistClean();
+  bool haveSSID = false;
 
   // Get the preferences
   prefs.begin("network", true, STORAGE_PARTITION);
-  loginUsername = prefs.getString("loginusername", "");
-  loginPassword = prefs.getString("loginpassword", "");
+  loginSet(prefs.getString("loginusername", "").c_str(), prefs.getString("loginpassword", "").c_str());
   wifiScanHidden = prefs.getBool("wifiscanhidden", false);
 
-  // Try connecting to known WiFi networks
+  // Get known WiFi networks
   for(int j=0 ; (j<3) ; j++)
   {
     char nameSSID[16], namePASS[16];
     sprintf(nameSSID, "wifissid%d", j+1);
     sprintf(namePASS, "wifipass%d", j+1);
 
-    String ssid = prefs.getString(nameSSID, "");
-    String password = prefs.getString(namePASS, "");
-
-    if(ssid != "")
-      wifiMulti.addAP(ssid.c_str(), password.c_str());
+    strlcpy(wifiSSID[j], prefs.getString(nameSSID, "").c_str(), sizeof(wifiSSID[j]));
+    strlcpy(wifiPass[j], prefs.getString(namePASS, "").c_str(), sizeof(wifiPass[j]));
+    haveSSID |= !!wifiSSID[j][0];
   }
 
+  // Get last joined access point
+  if(prefs.getBytes("wificache", &wifiCache, sizeof(wifiCache))!=sizeof(wifiCache))
+    memset(&wifiCache, 0, sizeof(wifiCache));
+
   // Done with preferences
   prefs.end();
 
-  drawScreen(status.c_str());
+  netStartTime = millis();
+
+  // Pick networks ourselves until connected
+  WiFi.setAutoReconnect(false);
+  wifiEvents.clear();
+  wifiUseLease(false);
+
+  if(!haveSSID)
+    wifiFailed();
+  else if(!wifiJoinCached())
+    wifiScan();
+}
+
+//
+// Switch between the cached IP address lease and DHCP
+//
+static void wifiUseLease(bool use)
+{
+  if(use)
+    WiFi.config(
+      IPAddress(wifiLease.ip), IPAddress(wifiLease.gateway),
+      IPAddress(wifiLease.subnet), IPAddress(wifiLease.dns)
+    );
+  else if(wifiStaticIP)
+    WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE);
+
+  wifiStaticIP = use;
+}
+
+//
+// Join the last joined access point, skipping the scan
+//
+static bool wifiJoinCached()
+{
+  int j;
+
+  // Access point must belong to a configured network
+  for(j=0 ; (j<3) && strcmp(wifiCache.ssid, wifiSSID[j]) ; j++);
+  if((j>=3) || !wifiCache.ssid[0] || !wifiCache.channel) return(false);
+
+  // Sync Only connections are short, a recent lease will do
+  wifiUseLease(
+    (netMode==NET_SYNC) && wifiLease.time &&
+    ((millis() - wifiLease.time) < WIFI_LEASE_TIME)
+  );
+
+  wifiDirect = true;
+  wifiCandidateCount = 0;
+  wifiCandidateIdx = 0;
+  WiFi.begin(wifiSSID[j], wifiPass[j], wifiCache.channel, wifiCache.bssid);
+  netState = NET_JOIN;
+  netStateTime = millis();
+  return(true);
+}
+
+//
+// Remember joined access point and IP address lease
+//
+static void wifiSaveCache()
+{
+  WiFiCache cache;
+  const uint8_t *bssid = WiFi.BSSID();
+
+  memset(&cache, 0, sizeof(cache));
+  strlcpy(cache.ssid, WiFi.SSID().c_str(), sizeof(cache.ssid));
+  if(bssid) memcpy(cache.bssid, bssid, sizeof(cache.bssid));
+  cache.channel = WiFi.channel();
+
+  // Keep the original lease time when reusing the lease
+  if(!wifiStaticIP)
+  {
+    wifiLease.ip      = WiFi.localIP();
+    wifiLease.gateway = WiFi.gatewayIP();
+    wifiLease.subnet  = WiFi.subnetMask();
+    wifiLease.dns     = WiFi.dnsIP();
+    wifiLease.time    = millis();
+  }
+
+  // Only write flash when the access point changes
+  if(memcmp(&cache, &wifiCache, sizeof(cache)))
+  {
+    wifiCache = cache;
+    prefs.begin("network", false, STORAGE_PARTITION);
+    prefs.putBytes("wificache", &wifiCache, sizeof(wifiCache));
+    prefs.end();
+  }
+}
+
+//
+// Start scanning for known networks in the background
+//
+static void wifiScan()
+{
+  WiFi.scanDelete();
+  WiFi.scanNetworks(true);
+  netState = NET_SCAN;
+  netStateTime = millis();
+}
+
+//
+// Take scan results, strongest known networks first
+//
+static void wifiPickCandidates(int16_t found)
+{
+  wifiCandidateCount = 0;
+  wifiCandidateIdx = 0;
 
-  consumeAbortPending();
-  wl_status_t wifiStatus = WL_NO_SSID_AVAIL;
-  uint32_t start = millis();
-  while(((millis() - start)<WIFI_MULTI_TOTAL_TIMEOUT) && (wifiStatus!=WL_CONNECTED))
+  for(int j=0 ; j<3 ; j++)
   {
-    wifiStatus = (wl_status_t)wifiMulti.run(5000, wifiScanHidden);
+    WiFiCandidate *c = &wifiCandidates[wifiCandidateCount];
+
+    if(!wifiSSID[j][0]) continue;
+
+    c->net     = j;
+    c->channel = 0;
+    c->rssi    = -1000;
 
-    if(consumeAbortPending())
+    // Strongest access point of this network
+    for(int i=0 ; i<found ; i++)
     {
-      WiFi.disconnect();
-      break;
+      if((WiFi.SSID(i)==wifiSSID[j]) && (WiFi.RSSI(i)>c->rssi))
+      {
+        c->channel = WiFi.channel(i);
+        c->rssi    = WiFi.RSSI(i);
+        memcpy(c->bssid, WiFi.BSSID(i), sizeof(c->bssid));
+      }
     }
 
-    if((wifiStatus!=WL_CONNECTED) && ((millis() - start)<WIFI_MULTI_TOTAL_TIMEOUT))
-      delay(1000);
+    // Hidden networks do not show up, try joining them by name
+    if(c->channel || wifiScanHidden) wifiCandidateCount++;
   }
 
-  // If failed connecting to WiFi network...
-  if (wifiStatus != WL_CONNECTED)
+  for(int j=1 ; j<wifiCandidateCount ; j++)
+    for(int i=j ; (i>0) && (wifiCandidates[i].rssi>wifiCandidates[i-1].rssi) ; i--)
+    {
+      WiFiCandidate c = wifiCandidates[i];
+      wifiCandidates[i] = wifiCandidates[i-1];
+      wifiCandidates[i-1] = c;
+    }
+}
+
+//
+// Join the next network, or wait and scan again if none left
+//
+static void wifiJoinNext()
+{
+  netStateTime = millis();
+
+  // Cached access point failed, look for networks
+  if(wifiDirect)
   {
-    // WiFi connection failed
-    drawScreen(status.c_str(), "No WiFi connection");
-    // Done
-    return(false);
+    wifiDirect = false;
+    wifiUseLease(false);
+    WiFi.disconnect();
+    wifiScan();
+    return;
+  }
+
+  if(wifiCandidateIdx>=wifiCandidateCount)
+  {
+    WiFi.disconnect();
+    netState = NET_RETRY;
+    return;
+  }
+
+  const WiFiCandidate *c = &wifiCandidates[wifiCandidateIdx++];
+  WiFi.begin(wifiSSID[c->net], wifiPass[c->net], c->channel, c->channel? c->bssid : NULL);
+  netState = NET_JOIN;
+}
+
+static void wifiConnected()
+{
+  uint32_t time = millis() - netStartTime;
+
+  // Report connection time and how the network was found
+  sprintf(wifiConnectInfo, "%u.%u s, %s",
+    (unsigned int)(time / 1000), (unsigned int)(time % 1000 / 100),
+    !wifiDirect? "after scan" : wifiStaticIP? "cached AP and IP" : "cached AP"
+  );
+
+  wifiSaveCache();
+  wifiDirect = false;
+  webStateChanged();
+
+  // WiFi connection succeeded
+  netSetMessage(
+    ("Connected to WiFi network (" + WiFi.SSID() + ")").c_str(),
+    ("IP : " + WiFi.localIP().toString() + " or atsmini.local").c_str()
+  );
+
+  // Let the WiFi driver reconnect if the connection drops
+  WiFi.setAutoReconnect(true);
+
+  // Get NTP time from the network
+  ntpStart();
+
+  if(netMode==NET_SYNC)
+  {
+    netState = NET_NTP;
+    netStateTime = millis();
   }
   else
   {
-    // WiFi connection succeeded
-    drawScreen(
-      ("Connected to WiFi network (" + WiFi.SSID() + ")").c_str(),
-      ("IP : " + WiFi.localIP().toString() + " or atsmini.local").c_str()
-    );
-    // Done
-    ajaxInterval = 1000;
+    netState = NET_IDLE;
+    if(netMode==NET_CONNECT) netServicesInit();
+  }
+}
+
+static void wifiFailed()
+{
+  // WiFi connection failed
+  netSetMessage("Connecting to WiFi network...", "No WiFi connection");
+  strcpy(wifiConnectInfo, "Failed");
+  webStateChanged();
+  wifiDirect = false;
+  wifiUseLease(false);
+  WiFi.disconnect();
+
+  if(netMode==NET_SYNC)
+    netStop();
+  else
+  {
+    netState = NET_IDLE;
+    if(netMode==NET_CONNECT) netServicesInit();
+  }
+}
+
+//
+// Advance network connection, TRUE if the screen needs an update
+//
+static bool wifiConnectTickTime()
+{
+  bool gotIP = false, dropped = false;
+  uint8_t event;
+
+  // Always take events, so stale ones do not pile up
+  while(wifiEvents.pop(&event))
+  {
+    gotIP   |= event==ARDUINO_EVENT_WIFI_STA_GOT_IP;
+    dropped |= event==ARDUINO_EVENT_WIFI_STA_DISCONNECTED;
+  }
+
+  switch(netState)
+  {
+    case NET_SCAN:
+    {
+      int16_t found = WiFi.scanComplete();
+      if(found==WIFI_SCAN_RUNNING) break;
+
+      // Failed scan finds nothing, hidden networks still get tried
+      wifiPickCandidates(found);
+      WiFi.scanDelete();
+      wifiJoinNext();
+      break;
+    }
+
+    case NET_JOIN:
+      if(gotIP)
+      {
+        wifiConnected();
+        return(true);
+      }
+      if(dropped || ((millis() - netStateTime) > WIFI_JOIN_TIMEOUT))
+        wifiJoinNext();
+      break;
+
+    case NET_RETRY:
+      if((millis() - netStateTime) > WIFI_RETRY_TIME) wifiScan();
+      break;
+
+    case NET_NTP:
+      // If only connected to sync, drop network connection once synced
+      if(ntpSynced || ((millis() - netStateTime) > NTP_SYNC_TIMEOUT))
+      {
+        netStop();
+        return(true);
+      }
+      return(false);
+
+    default:
+      return(false);
+  }
+
+  // Give up connecting after a while
+  if((millis() - netStartTime) > WIFI_CONNECT_TIMEOUT)
+  {
+    wifiFailed();
     return(true);
   }
+
+  return(false);
 }
 
 //
@@ -344,21 +1070,98 @@ static bool wifiConnect()
 //
 static void webInit()
 {
+  static bool webRoutesAdded = false;
+
+  // Routes and handlers are kept over reconnects, add them once
+  if(webRoutesAdded)
+  {
+    server.begin();
+    return;
+  }
+
+  webRoutesAdded = true;
+
+  // Set once, tags stay valid over reconnects
+  webBootId = esp_random() | 1;
+
+  // Not tagged, shows live frequency, signal and battery values
   server.on("/", HTTP_ANY, [] (AsyncWebServerRequest *request) {
-    request->send(200, "text/html", webRadioPage());
+    WebRadioInfo info;
+    webRadioInfo(&info);
+    webSendPage(request, "text/html", webRadioPage, info);
   });
 
   server.on("/memory", HTTP_ANY, [] (AsyncWebServerRequest *request) {
-    request->send(200, "text/html", webMemoryPage());
+    WebCacheTag tag;
+    if(webNotModified(request, &tag)) return;
+    // Too large for the web server task stack
+    static WebMemoryInfo info;
+    memcpy(info.memories, memories, sizeof(info.memories));
+    webSendPage(request, "text/html", webMemoryPage, info, 200, &tag);
   });
 
   server.on("/config", HTTP_ANY, [] (AsyncWebServerRequest *request) {
-    if(loginUsername != "" && loginPassword != "")
-      if(!request->authenticate(loginUsername.c_str(), loginPassword.c_str()))
+    if(!webAuthenticate(request))
+      return request->requestAuthentication();
+    WebCacheTag tag;
+    if(webNotModified(request, &tag)) return;
+    static WebConfigInfo info;
+    webConfigInfo(&info);
+    webSendPage(request, "text/html", webConfigPage, info, 200, &tag);
+  });
+
+  // Static pages, scripts, and the stylesheet are sent as stored
+  // in flash, browsers check back so new firmware shows up at once
+  for(const WebAsset &asset : webAssets)
+  {
+    server.on(asset.path, HTTP_GET, [&asset] (AsyncWebServerRequest *request) {
+      // Console logs in, so that the browser sends the login with
+      // the WebSocket handshake as well
+      if(!strcmp(asset.path, "/console") && !webAuthenticate(request))
         return request->requestAuthentication();
-    request->send(200, "text/html", webConfigPage());
+
+      AsyncWebServerResponse *response;
+      if(request->header("If-None-Match")==asset.etag)
+        response = request->beginResponse(304);
+      else
+      {
+        response = request->beginResponse(200, asset.type, asset.data, asset.size);
+        response->addHeader("Content-Encoding", "gzip");
+      }
+      response->addHeader("Cache-Control", "no-cache");
+      response->addHeader("ETag", asset.etag);
+      request->send(response);
+    });
+  }
+
+  server.on("/script.log", HTTP_ANY, [] (AsyncWebServerRequest *request) {
+    if(LittleFS.exists(SCRIPT_LOG_PATH))
+      request->send(LittleFS, SCRIPT_LOG_PATH, "text/plain");
+    else
+      request->send(404, "text/plain", "Not found");
   });
 
+  // Newly connected screen viewers need the whole screen
+  wsScreen.onEvent([] (AsyncWebSocket *ws, AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data, size_t len) {
+    if(type == WS_EVT_CONNECT) mirrorReset = true;
+  });
+  server.addHandler(&wsScreen);
+
+  // Newly connected status viewers need all values
+  wsStatus.onEvent([] (AsyncWebSocket *ws, AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data, size_t len) {
+    if(type == WS_EVT_CONNECT) statusReset = true;
+  });
+  server.addHandler(&wsStatus);
+
+  // Remote control console
+  wsRemoteInit(&server);
+
+  // JSON API
+  webApiInit(&server);
+
+  // Firmware upload
+  otaInit(&server);
+
   server.onNotFound([] (AsyncWebServerRequest *request) {
     request->send(404, "text/plain", "Not found");
   });
@@ -370,24 +1173,32 @@ static void webInit()
   server.begin();
 }
 
-void webSetConfig(AsyncWebServerRequest *request)
+static void webParamCopy(AsyncWebServerRequest *request, const char *name, char *buf, size_t size)
 {
-  uint32_t prefsSave = 0;
+  strlcpy(buf, request->getParam(name, true)->value().c_str(), size);
+}
 
-  // Start modifying preferences
-  prefs.begin("network", false, STORAGE_PARTITION);
+//
+// Runs in the web server task: queues the changes as a whole,
+// or none of them if the main loop has not caught up yet
+//
+void webSetConfig(AsyncWebServerRequest *request)
+{
+  // About 1 KiB, too much for the web server task stack
+  static WebCommand cmd[WEB_QUEUE_SIZE - 1];
+  int count = 0;
 
-  // Save user name and password
+  // User name and password
   if(request->hasParam("username", true) && request->hasParam("password", true))
   {
-    loginUsername = request->getParam("username", true)->value();
-    loginPassword = request->getParam("password", true)->value();
-
-    prefs.putString("loginusername", loginUsername);
-    prefs.putString("loginpassword", loginPassword);
+    cmd[count] = {};
+    cmd[count].type = WEB_SET_LOGIN;
+    webParamCopy(request, "username", cmd[count].name, sizeof(cmd[count].name));
+    webParamCopy(request, "password", cmd[count].pass, sizeof(cmd[count].pass));
+    count++;
   }
 
-  // Save SSIDs and their passwords
+  // SSIDs and their passwords
   bool haveSSID = false;
   for(int j=0 ; j<3 ; j++)
   {
@@ -398,353 +1209,458 @@ void webSetConfig(AsyncWebServerRequest *request)
 
     if(request->hasParam(nameSSID, true) && request->hasParam(namePASS, true))
     {
-      String ssid = request->getParam(nameSSID, true)->value();
-      String pass = request->getParam(namePASS, true)->value();
-      prefs.putString(nameSSID, ssid);
-      prefs.putString(namePASS, pass);
-      haveSSID |= ssid != "" && pass != "";
+      cmd[count] = {};
+      cmd[count].type  = WEB_SET_WIFI;
+      cmd[count].index = j;
+      webParamCopy(request, nameSSID, cmd[count].name, sizeof(cmd[count].name));
+      webParamCopy(request, namePASS, cmd[count].pass, sizeof(cmd[count].pass));
+      haveSSID |= cmd[count].name[0] && cmd[count].pass[0];
+      count++;
     }
   }
 
-  // Save hidden SSID scanning preference
-  wifiScanHidden = request->hasParam("wifiscanhidden", true);
-  prefs.putBool("wifiscanhidden", wifiScanHidden);
-
-  // Save time zone
-  if(request->hasParam("utcoffset", true))
+  // UDP remote control key, longer keys would be cut short
+  if(request->hasParam("remotekey", true))
   {
-    String utcOffset = request->getParam("utcoffset", true)->value();
-    utcOffsetIdx = utcOffset.toInt();
-    clockRefreshTime();
-    prefsSave |= SAVE_SETTINGS;
+    if(request->getParam("remotekey", true)->value().length() >= UDP_KEY_SIZE)
+    {
+      request->send(400, "text/plain", "Remote key is too long");
+      return;
+    }
+
+    cmd[count] = {};
+    cmd[count].type = WEB_SET_REMOTE_KEY;
+    webParamCopy(request, "remotekey", cmd[count].name, sizeof(cmd[count].name));
+    count++;
   }
 
-  // Save theme
-  if(request->hasParam("theme", true))
+  // Hidden SSID scanning, time zone, theme, scroll direction, and menu zoom
+  cmd[count] = {};
+  cmd[count].type       = WEB_SET_SETTINGS;
+  cmd[count].haveSSID   = haveSSID;
+  cmd[count].scanHidden = request->hasParam("wifiscanhidden", true);
+  cmd[count].utcOffset  = request->hasParam("utcoffset", true) ?
+    request->getParam("utcoffset", true)->value().toInt() : -1;
+  cmd[count].theme      = request->hasParam("theme", true) ?
+    request->getParam("theme", true)->value().toInt() : -1;
+  cmd[count].scroll     = request->hasParam("scroll", true);
+  cmd[count].zoom       = request->hasParam("zoom", true);
+
+  if(cmd[count].utcOffset >= getTotalUTCOffsets() || cmd[count].theme >= getTotalThemes())
   {
-    String theme = request->getParam("theme", true)->value();
-    themeIdx = theme.toInt();
-    prefsSave |= SAVE_SETTINGS;
+    request->send(400, "text/plain", "Invalid time zone or theme");
+    return;
   }
 
-  // Save scroll direction and menu zoom
-  scrollDirection = request->hasParam("scroll", true)? -1 : 1;
-  zoomMenu        = request->hasParam("zoom", true);
-  prefsSave |= SAVE_SETTINGS;
+  count++;
 
-  // Done with the preferences
-  prefs.end();
+  if(webCommands.room() < count)
+  {
+    request->send(503, "text/plain", "Busy");
+    return;
+  }
 
-  // Save preferences immediately
-  prefsRequestSave(prefsSave, true);
+  webCommands.push(cmd, count);
 
   // Show config page again
   request->redirect("/config");
+}
+
+//
+// Apply settings changes queued by the web server, returns remote events
+//
+int webLoop()
+{
+  const WebCommand *cmd;
+  bool changed = false;
+  bool connect = false;
+
+  while((cmd = webCommands.front()))
+  {
+    prefs.begin("network", false, STORAGE_PARTITION);
+
+    switch(cmd->type)
+    {
+      case WEB_SET_LOGIN:
+        loginSet(cmd->name, cmd->pass);
+        prefs.putString("loginusername", cmd->name);
+        prefs.putString("loginpassword", cmd->pass);
+        break;
+
+      case WEB_SET_WIFI:
+      {
+        char nameSSID[16], namePASS[16];
+
+        sprintf(nameSSID, "wifissid%d", cmd->index+1);
+        sprintf(namePASS, "wifipass%d", cmd->index+1);
+        prefs.putString(nameSSID, cmd->name);
+        prefs.putString(namePASS, cmd->pass);
+        break;
+      }
+
+      case WEB_SET_REMOTE_KEY:
+        prefs.putString("remotekey", cmd->name);
+        udpSetKey(cmd->name);
+        break;
+
+      case WEB_SET_SETTINGS:
+        wifiScanHidden = cmd->scanHidden;
+        prefs.putBool("wifiscanhidden", wifiScanHidden);
+
+        if(cmd->utcOffset >= 0)
+        {
+          utcOffsetIdx = cmd->utcOffset;
+          clockRefreshTime();
+        }
+
+        if(cmd->theme >= 0) themeIdx = cmd->theme;
+        scrollDirection = cmd->scroll ? -1 : 1;
+        zoomMenu        = cmd->zoom;
+        connect |= cmd->haveSSID;
+        break;
+    }
+
+    prefs.end();
+    webCommands.pop();
+    changed = true;
+  }
+
+  if(!changed) return(0);
+
+  // Save preferences immediately
+  prefsRequestSave(SAVE_SETTINGS, true);
 
   // If we are currently in AP mode, and infrastructure mode requested,
   // and there is at least one SSID / PASS pair, request network connection
-  if(haveSSID && (wifiModeIdx>NET_AP_ONLY) && (WiFi.status()!=WL_CONNECTED))
+  if(connect && (wifiModeIdx>NET_AP_ONLY) && (WiFi.status()!=WL_CONNECTED))
     netRequestConnect();
+
+  return(REMOTE_CHANGED);
 }
 
-static const String webInputField(const String &name, const String &value, bool pass)
+//
+// Screen mirroring: the sprite is split into tiles and only the tiles
+// that changed since the last update are sent to the browsers, each one
+// compressed with rleEncode(). Message format: tiles per row, tiles per
+// column, tile width, tile height, then for each tile its index, 16bit
+// little-endian encoded size, and encoded pixels.
+//
+static uint32_t mirrorTime  = 0;            // Last update time
+static uint32_t mirrorFrame = 0;            // Last mirrored frame
+static bool mirrorDirty = false;            // Some tiles are yet to be sent
+static uint32_t mirrorHash[MIRROR_MAX_TILES];
+
+static uint32_t mirrorTileHash(const uint16_t *pixels, int width, int x, int y)
 {
-  String newValue(value);
+  // FNV-1a over tile pixels
+  uint32_t hash = 2166136261u;
 
-  newValue.replace("\"", "&quot;");
-  newValue.replace("'", "&apos;");
+  for(int j=0 ; j<MIRROR_TILE_H ; j++)
+  {
+    const uint16_t *p = pixels + (y + j) * width + x;
+    for(int i=0 ; i<MIRROR_TILE_W ; i++)
+      hash = (hash ^ p[i]) * 16777619u;
+  }
 
-  return(
-    "<INPUT TYPE='" + String(pass? "PASSWORD":"TEXT") + "' NAME='" +
-    name + "' VALUE='" + newValue + "'>"
-  );
+  return(hash);
 }
 
-static const String webStyleSheet()
-{
-  return
-"BODY"
-"{"
-  "margin: 0;"
-  "padding: 0;"
-"}"
-"H1"
-"{"
-  "text-align: center;"
-"}"
-"TABLE"
-"{"
-  "width: 100%;"
-  "max-width: 768px;"
-  "border: 0px;"
-  "margin-left: auto;"
-  "margin-right: auto;"
-"}"
-"TH, TD"
-"{"
-  "padding: 0.5em;"
-"}"
-"TH.HEADING"
-"{"
-  "background-color: #80A0FF;"
-  "column-span: all;"
-  "text-align: center;"
-"}"
-"TD.LABEL"
-"{"
-  "text-align: right;"
-"}"
-"INPUT[type=text], INPUT[type=password], SELECT"
-"{"
-  "width: 95%;"
-  "padding: 0.5em;"
-"}"
-"INPUT[type=submit]"
-"{"
-  "width: 50%;"
-  "padding: 0.5em 0;"
-"}"
-".CENTER"
-"{"
-  "text-align: center;"
-"}"
-;
-}
-
-static const String webPage(const String &body)
-{
-  return
-"<!DOCTYPE HTML>"
-"<HTML>"
-"<HEAD>"
-  "<META CHARSET='UTF-8'>"
-  "<META NAME='viewport' CONTENT='width=device-width, initial-scale=1.0'>"
-  "<TITLE>ATS-Mini Config</TITLE>"
-  "<STYLE>" + webStyleSheet() + "</STYLE>"
-"</HEAD>"
-"<BODY STYLE='font-family: sans-serif;'>" + body + "</BODY>"
-"</HTML>"
-;
+//
+// Send given tiles, committing their hashes on success
+//
+static bool mirrorSend(uint8_t *buf, size_t size, const uint8_t *tiles, const uint32_t *hashes, int count)
+{
+  if(!wsScreen.availableForWriteAll()) return(false);
+
+  wsScreen.binaryAll(buf, size);
+  for(int i=0 ; i<count ; i++) mirrorHash[tiles[i]] = hashes[i];
+  return(true);
 }
 
-static const String webUtcOffsetSelector()
+static void mirrorTickTime()
 {
-  String result = "";
+  static uint8_t *buf = 0;
+  uint16_t tile[MIRROR_TILE_W * MIRROR_TILE_H];
+  uint8_t tiles[MIRROR_MAX_TILES];
+  uint32_t hashes[MIRROR_MAX_TILES];
+
+  if(!wsScreen.count() || ((millis() - mirrorTime) < MIRROR_TIME)) return;
+  mirrorTime = millis();
+  wsScreen.cleanupClients();
 
-  for(int i=0 ; i<getTotalUTCOffsets(); i++)
+  // New viewers get all tiles
+  if(mirrorReset)
   {
-    char text[64];
+    mirrorReset = false;
+    memset(mirrorHash, 0, sizeof(mirrorHash));
+    mirrorDirty = true;
+  }
 
-    sprintf(text,
-      "<OPTION VALUE='%d'%s>%s</OPTION>",
-      i, utcOffsetIdx==i? " SELECTED":"",
-      utcOffsets[i].desc
-    );
+  // Nothing has been drawn since the last update
+  if(!mirrorDirty && (drawFrameCount() == mirrorFrame)) return;
+
+  int width  = spr.width();
+  int height = spr.height();
+  int tilesX = width / MIRROR_TILE_W;
+  int tilesY = height / MIRROR_TILE_H;
+  const uint16_t *pixels = (const uint16_t *)spr.getPointer();
+
+  if(!buf) buf = (uint8_t *)malloc(MIRROR_BUF_SIZE);
+  if(!buf || !pixels || (tilesX * tilesY > MIRROR_MAX_TILES)) return;
+
+  size_t size = 0;
+  int count = 0;
+
+  mirrorFrame = drawFrameCount();
+  mirrorDirty = false;
+
+  for(int t=0 ; t<tilesX*tilesY ; t++)
+  {
+    int x = (t % tilesX) * MIRROR_TILE_W;
+    int y = (t / tilesX) * MIRROR_TILE_H;
+    uint32_t hash = mirrorTileHash(pixels, width, x, y);
+
+    if(hash == mirrorHash[t]) continue;
+
+    // Send accumulated tiles if the next one may not fit
+    if(count && (size + 3 + RLE_MAX_SIZE(ITEM_COUNT(tile)) > MIRROR_BUF_SIZE))
+    {
+      if(!mirrorSend(buf, size, tiles, hashes, count))
+      {
+        mirrorDirty = true;
+        return;
+      }
+      count = 0;
+    }
 
-    result += text;
+    // Start a new message
+    if(!count)
+    {
+      buf[0] = tilesX;
+      buf[1] = tilesY;
+      buf[2] = MIRROR_TILE_W;
+      buf[3] = MIRROR_TILE_H;
+      size = 4;
+    }
+
+    // Compress tile pixels
+    for(int j=0 ; j<MIRROR_TILE_H ; j++)
+      memcpy(tile + j * MIRROR_TILE_W, pixels + (y + j) * width + x, MIRROR_TILE_W * sizeof(uint16_t));
+
+    uint16_t len = rleEncode(tile, ITEM_COUNT(tile), buf + size + 3);
+    buf[size++] = t;
+    buf[size++] = len;
+    buf[size++] = len >> 8;
+    size += len;
+
+    tiles[count] = t;
+    hashes[count++] = hash;
   }
 
-  return(result);
+  // Send remaining tiles, retry on the next update if clients are busy
+  if(count && !mirrorSend(buf, size, tiles, hashes, count)) mirrorDirty = true;
 }
 
-static const String webThemeSelector()
+
+static void webPageStart(WebWriter &out, const char *title, const char *nav)
 {
-  String result = "";
+  out.print(
+"<!DOCTYPE HTML>"
+"<HTML>"
+"<HEAD>"
+  "<META CHARSET='UTF-8'>"
+  "<META NAME='viewport' CONTENT='width=device-width, initial-scale=1.0'>"
+  "<TITLE>"
+  );
+  out.print(title);
+  out.print(
+  "</TITLE>"
+  "<LINK REL='stylesheet' HREF='/style.css'>"
+"</HEAD>"
+"<BODY>"
+"<H1>"
+  );
+  out.print(title);
+  out.print("</H1><P ALIGN='CENTER'>");
+  out.print(nav);
+  out.print("</P>");
+}
 
-  for(int i=0 ; i<getTotalThemes(); i++)
-  {
-    char text[64];
+static void webPageEnd(WebWriter &out)
+{
+  out.print("</BODY></HTML>");
+}
 
-    sprintf(text,
-      "<OPTION VALUE='%d'%s>%s</OPTION>",
-       i, themeIdx==i? " SELECTED":"", theme[i].name
-    );
+static void webInputField(WebWriter &out, const char *name, const char *value, bool pass)
+{
+  out.printf("<INPUT TYPE='%s' NAME='%s' VALUE='", pass? "PASSWORD":"TEXT", name);
+  out.printEscaped(value);
+  out.print("'>");
+}
 
-    result += text;
-  }
+static void webCheckbox(WebWriter &out, const char *name, bool checked)
+{
+  out.printf("<INPUT TYPE='CHECKBOX' NAME='%s' VALUE='on'%s>", name, checked? " CHECKED ":"");
+}
+
+static void webRow(WebWriter &out, const char *label, const char *id = NULL)
+{
+  if(id)
+    out.printf("<TR><TD CLASS='LABEL'>%s</TD><TD ID='%s'>", label, id);
+  else
+    out.printf("<TR><TD CLASS='LABEL'>%s</TD><TD>", label);
+}
 
-  return(result);
+static void webHeading(WebWriter &out, const char *text)
+{
+  out.printf("<TR><TH COLSPAN=2 CLASS='HEADING'>%s</TH></TR>", text);
 }
 
-static const String webRadioPage()
+static void webRadioPage(WebWriter &out, const WebRadioInfo &info)
 {
-  String ip = "";
-  String ssid = "";
-  String freq = currentMode == FM?
-    String(currentFrequency / 100.0) + "MHz "
-  : String(currentFrequency + currentBFO / 1000.0) + "kHz ";
+  webPageStart(out, "ATS-Mini Pocket Receiver",
+    "<A HREF='/memory'>Memory</A>&nbsp;|&nbsp;<A HREF='/screen'>Screen</A>&nbsp;|&nbsp;<A HREF='/console'>Console</A>&nbsp;|&nbsp;<A HREF='/scope'>Scope</A>&nbsp;|&nbsp;<A HREF='/config'>Config</A>"
+  );
 
-  if(WiFi.status()==WL_CONNECTED)
+  out.print("<TABLE COLUMNS=2>");
+  webRow(out, "IP Address");
+  out.printf("<A HREF='http://%s'>%s</A> (", info.ip, info.ip);
+  out.printEscaped(info.ssid);
+  out.print(")</TD></TR>");
+  if(info.wifiConnect[0])
   {
-    ip = WiFi.localIP().toString();
-    ssid = WiFi.SSID();
+    webRow(out, "WiFi Connect");
+    out.printf("%s</TD></TR>", info.wifiConnect);
   }
+  webRow(out, "MAC Address");
+  out.printf("%s</TD></TR>", getMACAddress());
+  webRow(out, "Firmware");
+  out.printf("%s</TD></TR>", getVersion(true));
+  webRow(out, "Band", "band");
+  out.printf("%s</TD></TR>", info.band);
+  webRow(out, "Frequency", "freq");
+  if(info.mode == FM)
+    out.printf("%.2fMHz %s</TD></TR>", info.freq / 100.0, bandModeDesc[info.mode]);
   else
+    out.printf("%.2fkHz %s</TD></TR>", info.freq + info.bfo / 1000.0, bandModeDesc[info.mode]);
+  webRow(out, "Signal Strength", "rssi");
+  out.printf("%ddBuV</TD></TR>", info.rssi);
+  webRow(out, "Signal to Noise", "snr");
+  out.printf("%ddB</TD></TR>", info.snr);
+  webRow(out, "Battery Voltage", "battery");
+  out.printf("%.2fV</TD></TR>", info.voltage);
+  webRow(out, "Web Page Memory");
+  out.printf("%u bytes peak</TD></TR>", (unsigned int)info.pageHeap);
+  if(info.update[0])
   {
-    ip = WiFi.softAPIP().toString();
-    ssid = String(apSSID);
-  }
-
-  return webPage(
-"<H1>ATS-Mini Pocket Receiver</H1>"
-"<P ALIGN='CENTER'>"
-  "<A HREF='/memory'>Memory</A>&nbsp;|&nbsp;<A HREF='/config'>Config</A>"
-"</P>"
-"<TABLE COLUMNS=2>"
-"<TR>"
-  "<TD CLASS='LABEL'>IP Address</TD>"
-  "<TD><A HREF='http://" + ip + "'>" + ip + "</A> (" + ssid + ")</TD>"
-"</TR>"
-"<TR>"
-  "<TD CLASS='LABEL'>MAC Address</TD>"
-  "<TD>" + String(getMACAddress()) + "</TD>"
-"</TR>"
-"<TR>"
-  "<TD CLASS='LABEL'>Firmware</TD>"
-  "<TD>" + String(getVersion(true)) + "</TD>"
-"</TR>"
-"<TR>"
-  "<TD CLASS='LABEL'>Band</TD>"
-  "<TD>" + String(getCurrentBand()->bandName) + "</TD>"
-"</TR>"
-"<TR>"
-  "<TD CLASS='LABEL'>Frequency</TD>"
-  "<TD>" + freq + String(bandModeDesc[currentMode]) + "</TD>"
-"</TR>"
-"<TR>"
-  "<TD CLASS='LABEL'>Signal Strength</TD>"
-  "<TD>" + String(rssi) + "dBuV</TD>"
-"</TR>"
-"<TR>"
-  "<TD CLASS='LABEL'>Signal to Noise</TD>"
-  "<TD>" + String(snr) + "dB</TD>"
-"</TR>"
-"<TR>"
-  "<TD CLASS='LABEL'>Battery Voltage</TD>"
-  "<TD>" + String(batteryMonitor()) + "V</TD>"
-"</TR>"
-"</TABLE>"
-);
-}
-
-static const String webMemoryPage()
-{
-  String items = "";
+    webRow(out, "Firmware Update");
+    out.printEscaped(info.update);
+    out.print("</TD></TR>");
+  }
+  out.print("</TABLE>");
+
+  // Live values over WebSocket
+  out.print("<SCRIPT SRC='/status.js'></SCRIPT>");
+
+  webPageEnd(out);
+}
+
+static void webMemoryPage(WebWriter &out, const WebMemoryInfo &info)
+{
+  webPageStart(out, "ATS-Mini Pocket Receiver Memory",
+    "<A HREF='/'>Status</A>&nbsp;|&nbsp;<A HREF='/screen'>Screen</A>&nbsp;|&nbsp;<A HREF='/console'>Console</A>&nbsp;|&nbsp;<A HREF='/scope'>Scope</A>&nbsp;|&nbsp;<A HREF='/config'>Config</A>"
+  );
 
+  out.print("<TABLE COLUMNS=2>");
   for(int j=0 ; j<MEMORY_COUNT ; j++)
   {
-    char text[64];
-    sprintf(text, "<TR><TD CLASS='LABEL' WIDTH='10%%'>%02d</TD><TD>", j+1);
-    items += text;
+    const Memory *mem = &info.memories[j];
 
-    if(!memories[j].freq)
-      items += "&nbsp;---&nbsp;</TD></TR>";
+    out.printf("<TR><TD CLASS='LABEL' WIDTH='10%%'>%02d</TD><TD>", j+1);
+    if(!mem->freq)
+      out.print("&nbsp;---&nbsp;</TD></TR>");
+    else if(mem->mode == FM)
+      out.printf("%.2fMHz %s</TD></TR>", mem->freq / 1000000.0, bandModeDesc[mem->mode]);
     else
-    {
-      String freq = memories[j].mode == FM?
-        String(memories[j].freq / 1000000.0) + "MHz "
-      : String(memories[j].freq / 1000.0) + "kHz ";
-      items += freq + bandModeDesc[memories[j].mode] + "</TD></TR>";
-    }
+      out.printf("%.2fkHz %s</TD></TR>", mem->freq / 1000.0, bandModeDesc[mem->mode]);
   }
+  out.print("</TABLE>");
 
-  return webPage(
-"<H1>ATS-Mini Pocket Receiver Memory</H1>"
-"<P ALIGN='CENTER'>"
-  "<A HREF='/'>Status</A>&nbsp;|&nbsp;<A HREF='/config'>Config</A>"
-"</P>"
-"<TABLE COLUMNS=2>" + items + "</TABLE>"
-);
+  webPageEnd(out);
 }
 
-const String webConfigPage()
+static void webConfigPage(WebWriter &out, const WebConfigInfo &info)
 {
-  prefs.begin("network", true, STORAGE_PARTITION);
-  String ssid1 = prefs.getString("wifissid1", "");
-  String pass1 = prefs.getString("wifipass1", "");
-  String ssid2 = prefs.getString("wifissid2", "");
-  String pass2 = prefs.getString("wifipass2", "");
-  String ssid3 = prefs.getString("wifissid3", "");
-  String pass3 = prefs.getString("wifipass3", "");
-  bool scanHidden = prefs.getBool("wifiscanhidden", false);
-  prefs.end();
+  webPageStart(out, "ATS-Mini Config",
+    "<A HREF='/'>Status</A>"
+    "&nbsp;|&nbsp;<A HREF='/memory'>Memory</A>"
+    "&nbsp;|&nbsp;<A HREF='/screen'>Screen</A>"
+    "&nbsp;|&nbsp;<A HREF='/console'>Console</A>"
+    "&nbsp;|&nbsp;<A HREF='/scope'>Scope</A>"
+  );
+
+  out.print("<FORM ACTION='/setconfig' METHOD='POST'><TABLE COLUMNS=2>");
 
-  return webPage(
-"<H1>ATS-Mini Config</H1>"
-"<P ALIGN='CENTER'>"
-  "<A HREF='/'>Status</A>"
-  "&nbsp;|&nbsp;<A HREF='/memory'>Memory</A>"
-"</P>"
-"<FORM ACTION='/setconfig' METHOD='POST'>"
-  "<TABLE COLUMNS=2>"
-  "<TR><TH COLSPAN=2 CLASS='HEADING'>WiFi Network 1</TH></TR>"
-  "<TR>"
-    "<TD CLASS='LABEL'>SSID</TD>"
-    "<TD>" + webInputField("wifissid1", ssid1) + "</TD>"
-  "</TR>"
-  "<TR>"
-    "<TD CLASS='LABEL'>Password</TD>"
-    "<TD>" + webInputField("wifipass1", pass1, true) + "</TD>"
-  "</TR>"
-  "<TR><TH COLSPAN=2 CLASS='HEADING'>WiFi Network 2</TH></TR>"
-  "<TR>"
-    "<TD CLASS='LABEL'>SSID</TD>"
-    "<TD>" + webInputField("wifissid2", ssid2) + "</TD>"
-  "</TR>"
-  "<TR>"
-    "<TD CLASS='LABEL'>Password</TD>"
-    "<TD>" + webInputField("wifipass2", pass2, true) + "</TD>"
-  "</TR>"
-  "<TR><TH COLSPAN=2 CLASS='HEADING'>WiFi Network 3</TH></TR>"
-  "<TR>"
-    "<TD CLASS='LABEL'>SSID</TD>"
-    "<TD>" + webInputField("wifissid3", ssid3) + "</TD>"
-  "</TR>"
-  "<TR>"
-    "<TD CLASS='LABEL'>Password</TD>"
-    "<TD>" + webInputField("wifipass3", pass3, true) + "</TD>"
-  "</TR>"
-  "<TR><TH COLSPAN=2 CLASS='HEADING'>This Web UI Login Credentials</TH></TR>"
-  "<TR>"
-    "<TD CLASS='LABEL'>Username</TD>"
-    "<TD>" + webInputField("username", loginUsername) + "</TD>"
-  "</TR>"
-  "<TR>"
-    "<TD CLASS='LABEL'>Password</TD>"
-    "<TD>" + webInputField("password", loginPassword, true) + "</TD>"
-  "</TR>"
-  "<TR><TH COLSPAN=2 CLASS='HEADING'>Settings</TH></TR>"
-  "<TR>"
-    "<TD CLASS='LABEL'>Scan Hidden SSIDs</TD>"
-    "<TD><INPUT TYPE='CHECKBOX' NAME='wifiscanhidden' VALUE='on'" +
-    (scanHidden? " CHECKED ":"") + "></TD>"
-  "</TR>"
-  "<TR>"
-    "<TD CLASS='LABEL'>Time Zone</TD>"
-    "<TD>"
-      "<SELECT NAME='utcoffset'>" + webUtcOffsetSelector() + "</SELECT>"
-    "</TD>"
-  "</TR>"
-  "<TR>"
-    "<TD CLASS='LABEL'>Theme</TD>"
-    "<TD>"
-      "<SELECT NAME='theme'>" + webThemeSelector() + "</SELECT>"
-    "</TD>"
-  "</TR>"
-  "<TR>"
-    "<TD CLASS='LABEL'>Reverse Scrolling</TD>"
-    "<TD><INPUT TYPE='CHECKBOX' NAME='scroll' VALUE='on'" +
-    (scrollDirection<0? " CHECKED ":"") + "></TD>"
-  "</TR>"
-   "<TR>"
-    "<TD CLASS='LABEL'>Zoomed Menu</TD>"
-    "<TD><INPUT TYPE='CHECKBOX' NAME='zoom' VALUE='on'" +
-    (zoomMenu? " CHECKED ":"") + "></TD>"
-  "</TR>"
+  for(int j=0 ; j<3 ; j++)
+  {
+    char name[16];
+
+    out.printf("<TR><TH COLSPAN=2 CLASS='HEADING'>WiFi Network %d</TH></TR>", j+1);
+    webRow(out, "SSID");
+    sprintf(name, "wifissid%d", j+1);
+    webInputField(out, name, info.ssid[j], false);
+    out.print("</TD></TR>");
+    webRow(out, "Password");
+    sprintf(name, "wifipass%d", j+1);
+    webInputField(out, name, info.pass[j], true);
+    out.print("</TD></TR>");
+  }
+
+  webHeading(out, "This Web UI Login Credentials");
+  webRow(out, "Username");
+  webInputField(out, "username", info.username, false);
+  out.print("</TD></TR>");
+  webRow(out, "Password");
+  webInputField(out, "password", info.password, true);
+  out.print("</TD></TR>");
+
+  webHeading(out, "UDP Remote Control");
+  webRow(out, "Key");
+  webInputField(out, "remotekey", info.remoteKey, true);
+  out.print("</TD></TR>");
+
+  webHeading(out, "Settings");
+  webRow(out, "Scan Hidden SSIDs");
+  webCheckbox(out, "wifiscanhidden", info.scanHidden);
+  out.print("</TD></TR>");
+
+  webRow(out, "Time Zone");
+  out.print("<SELECT NAME='utcoffset'>");
+  for(int i=0 ; i<getTotalUTCOffsets() ; i++)
+    out.printf("<OPTION VALUE='%d'%s>%s</OPTION>", i, info.utcOffset==i? " SELECTED":"", utcOffsets[i].desc);
+  out.print("</SELECT></TD></TR>");
+
+  webRow(out, "Theme");
+  out.print("<SELECT NAME='theme'>");
+  for(int i=0 ; i<getTotalThemes() ; i++)
+    out.printf("<OPTION VALUE='%d'%s>%s</OPTION>", i, info.theme==i? " SELECTED":"", theme[i].name);
+  out.print("</SELECT></TD></TR>");
+
+  webRow(out, "Reverse Scrolling");
+  webCheckbox(out, "scroll", info.scroll);
+  out.print("</TD></TR>");
+  webRow(out, "Zoomed Menu");
+  webCheckbox(out, "zoom", info.zoom);
+  out.print("</TD></TR>");
+
+  out.print(
   "<TR><TH COLSPAN=2 CLASS='HEADING'>"
     "<INPUT TYPE='SUBMIT' VALUE='Save'>"
   "</TH></TR>"
   "</TABLE>"
 "</FORM>"
-);
+"<P ALIGN='CENTER'><A HREF='/update'>Firmware Update</A></P>"
+  );
+
+  webPageEnd(out);
 }
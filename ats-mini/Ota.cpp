@@ -0,0 +1,193 @@
+#include "Common.h"
+#include "Storage.h"
+#include "Draw.h"
+#include "WebWriter.h"
+#include "Ota.h"
+
+#include <Update.h>
+#include <esp_ota_ops.h>
+
+#define OTA_REBOOT_DELAY   1000  // Time for the reply to reach the browser (ms)
+#define OTA_VERIFY_TIME   10000  // New firmware is confirmed after running this long (ms)
+#define OTA_MAGIC    0x4F544131  // Marks valid data in otaRtc
+
+//
+// Firmware update: the web server task writes the uploaded image
+// straight into the inactive app partition as it arrives, and the
+// main loop reboots into it. New firmware has to run for a while
+// before it is confirmed, if it crashes or is reset before that,
+// the bootloader goes back to the previous firmware.
+//
+
+// Kept over the software reset into the new firmware
+typedef struct
+{
+  uint32_t magic;          // OTA_MAGIC
+  uint32_t address;        // Address of the updated partition
+  uint32_t size;           // Firmware size (bytes)
+  uint32_t uploadTime;     // Upload time, including writing (ms)
+  uint32_t restartTime;    // Time from upload end to restart (ms)
+} OtaRtc;
+
+static RTC_NOINIT_ATTR OtaRtc otaRtc;
+
+// Upload state, used by the web server task only
+static AsyncWebServerRequest *otaOwner = NULL;  // Request being written
+static const char *otaError = NULL;             // Error of the current upload
+static uint32_t otaStartTime = 0;               // Upload start time
+
+static volatile uint32_t otaDoneTime = 0;       // Upload end time, reboot pending
+static bool otaVerifyPending = false;           // Running firmware is not confirmed yet
+static char otaResult[80] = "";                 // Shown on the status page
+
+// Keep new firmware pending until otaTickTime() confirms it
+extern "C" bool verifyRollbackLater()
+{
+  return(true);
+}
+
+const char *otaStatus()
+{
+  return(otaResult);
+}
+
+//
+// Runs in the web server task for every received part of the body
+//
+static void otaReceive(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total)
+{
+  if(!index)
+  {
+    // One update at a time, from users allowed to change settings
+    if(otaOwner || otaDoneTime || !webAuthenticate(request)) return;
+
+    otaOwner = request;
+    otaError = NULL;
+    otaStartTime = millis();
+    request->onDisconnect([request] () {
+      if(otaOwner != request) return;
+      Update.abort();
+      otaOwner = NULL;
+    });
+
+    if(!Update.begin(total))
+      otaError = Update.errorString();
+    else if(request->hasParam("md5") && !Update.setMD5(request->getParam("md5")->value().c_str()))
+      otaError = "Invalid MD5 checksum";
+  }
+
+  if((otaOwner != request) || otaError) return;
+
+  if(Update.write(data, len) != len)
+  {
+    otaError = Update.errorString();
+    Update.abort();
+  }
+  else if(index + len == total)
+  {
+    // Checks size, MD5, and image hash, then selects the new boot partition
+    if(!Update.end())
+      otaError = Update.errorString();
+    else
+    {
+      otaRtc.address    = esp_ota_get_next_update_partition(NULL)->address;
+      otaRtc.size       = total;
+      otaRtc.uploadTime = millis() - otaStartTime;
+    }
+  }
+}
+
+static void otaRequest(AsyncWebServerRequest *request)
+{
+  char buf[96];
+
+  if(!webAuthenticate(request))
+    return(request->requestAuthentication());
+  if(!request->contentLength())
+    return(request->send(400, "text/plain", "Expected a firmware image"));
+  if(otaOwner != request)
+    return(request->send(503, "text/plain", "Another update is in progress"));
+
+  otaOwner = NULL;
+  if(otaError || !Update.isFinished())
+  {
+    if(Update.isRunning()) Update.abort();
+    sprintf(buf, "Update failed: %s", otaError ? otaError : "incomplete upload");
+    return(request->send(400, "text/plain", buf));
+  }
+
+  uint32_t time = otaRtc.uploadTime ? otaRtc.uploadTime : 1;
+  sprintf(buf, "Updated %u bytes in %u.%01u s (%u KiB/s), rebooting",
+    (unsigned int)otaRtc.size, (unsigned int)(time / 1000), (unsigned int)(time % 1000 / 100),
+    (unsigned int)(otaRtc.size * 1000ULL / time / 1024));
+  request->send(200, "text/plain", buf);
+
+  // Main loop reboots once the reply is out
+  otaDoneTime = millis();
+}
+
+void otaInit(AsyncWebServer *server)
+{
+  server->on("/update", HTTP_POST, otaRequest, NULL, otaReceive);
+}
+
+//
+// First call after boot: report the update that led to it
+//
+static void otaBootCheck()
+{
+  const esp_partition_t *running = esp_ota_get_running_partition();
+  esp_ota_img_states_t state;
+
+  otaVerifyPending =
+    (esp_ota_get_state_partition(running, &state) == ESP_OK) &&
+    (state == ESP_OTA_IMG_PENDING_VERIFY);
+
+  if(otaRtc.magic != OTA_MAGIC) return;
+  otaRtc.magic = 0;
+
+  if(running->address != otaRtc.address)
+  {
+    strcpy(otaResult, "Update failed to boot, rolled back");
+    return;
+  }
+
+  // Upload speed, and time from the end of upload until running again
+  uint32_t time = otaRtc.uploadTime ? otaRtc.uploadTime : 1;
+  uint32_t reboot = otaRtc.restartTime + millis();
+  sprintf(otaResult, "%u KiB at %u KiB/s, rebooted in %u.%01u s",
+    (unsigned int)(otaRtc.size / 1024), (unsigned int)(otaRtc.size * 1000ULL / time / 1024),
+    (unsigned int)(reboot / 1000), (unsigned int)(reboot % 1000 / 100));
+}
+
+void otaTickTime()
+{
+  static bool booted = false;
+
+  if(!booted)
+  {
+    otaBootCheck();
+    booted = true;
+  }
+
+  // New firmware has been running long enough
+  if(otaVerifyPending && (millis() > OTA_VERIFY_TIME))
+  {
+    esp_ota_mark_app_valid_cancel_rollback();
+    otaVerifyPending = false;
+  }
+
+  // Reboot into new firmware
+  if(otaDoneTime && ((millis() - otaDoneTime) > OTA_REBOOT_DELAY))
+  {
+    drawScreen("Firmware updated", "Rebooting...");
+
+    // Save pending preferences changes now
+    prefsRequestSave(0, true);
+    prefsTickTime();
+
+    otaRtc.restartTime = millis() - otaDoneTime;
+    otaRtc.magic = OTA_MAGIC;
+    ESP.restart();
+  }
+}
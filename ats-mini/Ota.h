@@ -0,0 +1,15 @@
+#ifndef OTA_H
+#define OTA_H
+
+#include <ESPAsyncWebServer.h>
+
+// Register the firmware upload handler at /update
+void otaInit(AsyncWebServer *server);
+
+// Confirm running firmware, reboot into uploaded firmware
+void otaTickTime();
+
+// Result of the last firmware update, empty if none
+const char *otaStatus();
+
+#endif
@@ -0,0 +1,174 @@
+#include "Common.h"
+#include "Themes.h"
+#include "Menu.h"
+#include "Draw.h"
+#include "Profile.h"
+
+#define BENCH_FRAMES  16  // Frames rendered per benchmarked screen
+#define BENCH_RSSI    60  // Signal strength shown during the benchmark
+
+#ifdef DRAW_PROFILE
+
+static const char *profileNames[PROF_COUNT] =
+{
+  "Screen", "Push", "LayoutDefault", "LayoutSmeter", "About",
+  "SaveIcon", "BleIcon", "WiFiIcon", "Battery", "BandMode",
+  "Frequency", "StationName", "SideBar", "SMeter", "SNMeter",
+  "Stereo", "Scale", "ScanGraphs", "RadioText", "WiFiStatus",
+  "ZoomedMenu"
+};
+
+static struct
+{
+  uint32_t count;  // Number of calls
+  uint32_t min;    // Minimum cycles per call
+  uint32_t max;    // Maximum cycles per call
+  uint64_t total;  // Total cycles
+} profileTable[PROF_COUNT];
+
+//
+// Account given number of CPU cycles to a screen element
+//
+void profileRecord(uint8_t id, uint32_t cycles)
+{
+  if(id >= PROF_COUNT) return;
+
+  if(!profileTable[id].count || cycles < profileTable[id].min)
+    profileTable[id].min = cycles;
+  if(cycles > profileTable[id].max)
+    profileTable[id].max = cycles;
+
+  profileTable[id].total += cycles;
+  profileTable[id].count++;
+}
+
+#endif // DRAW_PROFILE
+
+//
+// Print per-element min/avg/max cycle counts to the remote
+//
+void profilePrint(Stream *stream)
+{
+#ifdef DRAW_PROFILE
+  uint32_t mhz = getCpuFrequencyMhz();
+
+  stream->printf("\r\nElement,Calls,Min,Avg,Max,AvgUs (%" PRIu32 "MHz)\r\n", mhz);
+
+  for(int i=0 ; i<PROF_COUNT ; i++)
+  {
+    if(!profileTable[i].count) continue;
+
+    uint32_t avg = profileTable[i].total / profileTable[i].count;
+    stream->printf("%s,%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 "\r\n",
+      profileNames[i],
+      profileTable[i].count,
+      profileTable[i].min,
+      avg,
+      profileTable[i].max,
+      avg / mhz
+    );
+  }
+
+  // Start collecting from scratch
+  memset(profileTable, 0, sizeof(profileTable));
+#else
+  stream->println("\r\nProfiler is disabled, rebuild with DRAW_PROFILE");
+#endif
+}
+
+#ifdef DRAW_PROFILE
+
+//
+// Render a single frame into the sprite, without pushing it
+// to the display, and return CPU cycles spent on it
+//
+static uint32_t profileRenderFrame()
+{
+  uint32_t start = ESP.getCycleCount();
+
+  spr.fillSprite(TH.bg);
+
+  if(currentCmd==CMD_ABOUT)
+    drawAbout();
+  else if(uiLayoutIdx==UI_SMETER)
+    drawLayoutSmeter(0, 0);
+  else
+    drawLayoutDefault(0, 0);
+
+  return(ESP.getCycleCount() - start);
+}
+
+#endif // DRAW_PROFILE
+
+//
+// Render canned screens for each layout and print min/avg/max
+// cycle counts per frame to the remote
+//
+void profileBenchmark(Stream *stream)
+{
+#ifdef DRAW_PROFILE
+  static const struct
+  {
+    uint16_t cmd;
+    const char *name;
+  } screens[] =
+  {
+    { CMD_NONE,   "Tuning" },
+    { CMD_FREQ,   "FreqInput" },
+    { CMD_VOLUME, "Volume" },
+    { CMD_MENU,   "Menu" },
+    { CMD_SCAN,   "Scan" },
+    { CMD_ABOUT,  "About" },
+  };
+
+  static const char *layouts[] = { "Default", "SMeter" };
+
+  // Save state modified by the benchmark
+  uint16_t savedCmd    = currentCmd;
+  uint8_t  savedLayout = uiLayoutIdx;
+  uint8_t  savedRssi   = rssi;
+  uint32_t mhz         = getCpuFrequencyMhz();
+
+  // Per-element statistics will only cover benchmark frames
+  memset(profileTable, 0, sizeof(profileTable));
+
+  stream->printf("\r\nLayout,Screen,Min,Avg,Max,AvgUs (%" PRIu32 "MHz)\r\n", mhz);
+
+  rssi = BENCH_RSSI;
+
+  for(unsigned int j=0 ; j<ITEM_COUNT(layouts) ; j++)
+  {
+    uiLayoutIdx = j;
+
+    for(unsigned int i=0 ; i<ITEM_COUNT(screens) ; i++)
+    {
+      uint32_t min = 0, max = 0;
+      uint64_t total = 0;
+
+      currentCmd = screens[i].cmd;
+
+      for(int n=0 ; n<BENCH_FRAMES ; n++)
+      {
+        uint32_t cycles = profileRenderFrame();
+        if(!n || cycles < min) min = cycles;
+        if(cycles > max) max = cycles;
+        total += cycles;
+        // Let other tasks run between frames
+        delay(1);
+      }
+
+      uint32_t avg = total / BENCH_FRAMES;
+      stream->printf("%s,%s,%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 "\r\n",
+        layouts[j], screens[i].name, min, avg, max, avg / mhz
+      );
+    }
+  }
+
+  // Restore state, the caller will redraw the screen
+  currentCmd  = savedCmd;
+  uiLayoutIdx = savedLayout;
+  rssi        = savedRssi;
+#else
+  stream->println("\r\nProfiler is disabled, rebuild with DRAW_PROFILE");
+#endif
+}
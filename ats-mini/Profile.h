@@ -0,0 +1,62 @@
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include "Common.h"
+
+// Profiled screen elements
+#define PROF_SCREEN          0  // drawScreen()
+#define PROF_PUSH            1  // Sprite push to the display
+#define PROF_LAYOUT_DEFAULT  2  // drawLayoutDefault()
+#define PROF_LAYOUT_SMETER   3  // drawLayoutSmeter()
+#define PROF_ABOUT           4  // drawAbout()
+#define PROF_SAVE_ICON       5  // drawSaveIndicator()
+#define PROF_BLE_ICON        6  // drawBleIndicator()
+#define PROF_WIFI_ICON       7  // drawWiFiIndicator()
+#define PROF_BATTERY         8  // drawBattery()
+#define PROF_BAND_MODE       9  // drawBandAndMode()
+#define PROF_FREQUENCY      10  // drawFrequency()
+#define PROF_STATION_NAME   11  // drawStationName(), drawLongStationName()
+#define PROF_SIDEBAR        12  // drawSideBar()
+#define PROF_SMETER         13  // drawSMeter(), drawLargeSMeter()
+#define PROF_SNMETER        14  // drawLargeSNMeter()
+#define PROF_STEREO         15  // drawStereoIndicator(), drawAltStereoIndicator()
+#define PROF_SCALE          16  // drawScale(), drawSmallScale()
+#define PROF_SCAN_GRAPHS    17  // drawScanGraphs()
+#define PROF_RADIO_TEXT     18  // drawRadioText()
+#define PROF_WIFI_STATUS    19  // drawWiFiStatus()
+#define PROF_ZOOMED_MENU    20  // drawZoomedMenu()
+#define PROF_COUNT          21
+
+// Print collected statistics and reset them
+void profilePrint(Stream *stream);
+
+// Render canned screens off-screen and print per-frame timings
+void profileBenchmark(Stream *stream);
+
+#ifdef DRAW_PROFILE
+
+void profileRecord(uint8_t id, uint32_t cycles);
+
+//
+// Measure CPU cycles spent between construction and destruction
+//
+class ProfileScope
+{
+  public:
+    ProfileScope(uint8_t id) : id(id), start(ESP.getCycleCount()) {}
+    ~ProfileScope() { profileRecord(id, ESP.getCycleCount() - start); }
+
+  private:
+    uint8_t id;
+    uint32_t start;
+};
+
+#define PROFILE(id) ProfileScope profileScope##id(id)
+
+#else
+
+#define PROFILE(id)
+
+#endif // DRAW_PROFILE
+
+#endif // PROFILE_H
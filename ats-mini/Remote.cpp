@@ -4,8 +4,21 @@
 #include "Menu.h"
 #include "Draw.h"
 #include "Remote.h"
+#include "RemoteBinary.h"
+#include "Cat.h"
+#include "Profile.h"
+#include "Telemetry.h"
+#include "Script.h"
+
+#include <ctype.h>
+
+#define REMOTE_LINE_TIMEOUT 10000  // Drop incomplete command lines after this time (ms)
+#define REMOTE_JOB_TIMEOUT   3000  // Drop job output the client has not taken for this long (ms)
+#define REMOTE_CAPTURE_HOLD 10000  // Longest time to hold background redraws for a screenshot (ms)
 
 static RemoteState remoteSerialState;
+static BinaryState binarySerialState;
+static CatState catSerialState;
 
 static uint8_t char2nibble(char key)
 {
@@ -16,133 +29,61 @@ static uint8_t char2nibble(char key)
 }
 
 //
-// Capture current screen image to the remote
+// Parse an unsigned decimal number from the command line
 //
-static void remoteCaptureScreen(Stream* stream)
+static long int remoteParseInteger(const char **p)
 {
-  uint16_t width  = spr.width();
-  uint16_t height = spr.height();
-
-  // 14 bytes of BMP header
-  stream->println("");
-  stream->print("424d"); // BM
-  // Image size
-  stream->printf("%08x", (unsigned int)htonl(14 + 40 + 12 + width * height * 2));
-  stream->print("00000000");
-  // Offset to image data
-  stream->printf("%08x", (unsigned int)htonl(14 + 40 + 12));
-  // Image header
-  stream->print("28000000"); // Header size
-  stream->printf("%08x", (unsigned int)htonl(width));
-  stream->printf("%08x", (unsigned int)htonl(height));
-  stream->print("01001000"); // 1 plane, 16 bpp
-  stream->print("03000000"); // Compression
-  stream->print("00000000"); // Compressed image size
-  stream->print("00000000"); // X res
-  stream->print("00000000"); // Y res
-  stream->print("00000000"); // Color map
-  stream->print("00000000"); // Colors
-  stream->print("00f80000"); // Red mask
-  stream->print("e0070000"); // Green mask
-  stream->println("1f000000"); // Blue mask
-
-  // Image data
-  for(int y=height-1 ; y>=0 ; y--)
-  {
-    for(int x=0 ; x<width ; x++)
-    {
-      stream->printf("%04x", htons(spr.readPixel(x, y)));
-    }
-    stream->println("");
-  }
-  stream->flush();
-}
-
-char remoteReadChar(Stream* stream)
-{
-  char key;
+  long int result = 0;
 
-  while (!stream->available());
-  key = stream->read();
-  stream->print(key);
-  return key;
-}
+  // Can overflow, but it's ok
+  for(; (**p >= '0') && (**p <= '9') ; (*p)++)
+    result = result * 10 + (**p - '0');
 
-long int remoteReadInteger(Stream* stream)
-{
-  long int result = 0;
-  while (true) {
-    char ch = stream->peek();
-    if (ch == 0xFF) {
-      continue;
-    } else if ((ch >= '0') && (ch <= '9')) {
-      ch = remoteReadChar(stream);
-      // Can overflow, but it's ok
-      result = result * 10 + (ch - '0');
-    } else {
-      return result;
-    }
-  }
+  return(result);
 }
 
-void remoteReadString(Stream* stream, char *bufStr, uint8_t bufLen)
+//
+// Parse a string up to the next comma or end of the command line
+//
+static void remoteParseString(const char **p, char *bufStr, uint8_t bufLen)
 {
   uint8_t length = 0;
-  while (true) {
-    char ch = stream->peek();
-    if (ch == 0xFF) {
-      continue;
-    } else if (ch == ',' || ch < ' ') {
-      bufStr[length] = '\0';
-      return;
-    } else {
-      ch = remoteReadChar(stream);
-      bufStr[length] = ch;
-      if (++length >= bufLen - 1) {
-        bufStr[length] = '\0';
-        return;
-      }
-    }
-  }
+
+  for(; **p && (**p != ',') && (length < bufLen - 1) ; (*p)++)
+    bufStr[length++] = **p;
+
+  bufStr[length] = '\0';
 }
 
-static bool expectNewline(Stream* stream)
+//
+// Skip given character, return false if it is not there
+//
+static bool remoteParseChar(const char **p, char ch)
 {
-  char ch;
-  while ((ch = stream->peek()) == 0xFF);
-  if (ch == '\r') {
-    stream->read();
-    return true;
-  }
-  return false;
+  if(**p != ch) return(false);
+  (*p)++;
+  return(true);
 }
 
 static bool remoteShowError(Stream* stream, const char *message)
 {
-  // Consume the remaining input
-  while (stream->available()) remoteReadChar(stream);
   stream->printf("\r\nError: %s\r\n", message);
   return false;
 }
 
-static bool remoteSetFrequency(Stream *stream)
+//
+// Tune to the given frequency within the current band,
+// return error message or NULL on success
+//
+const char *remoteTuneFrequency(uint32_t freqHz)
 {
-  stream->print('F');
-
-  long int freqHz = remoteReadInteger(stream);
-  if(freqHz <= 0)
-    return remoteShowError(stream, "Invalid frequency");
-  if(!expectNewline(stream))
-    return remoteShowError(stream, "Expected newline");
-  stream->println();
-
   Band *band = getCurrentBand();
   uint16_t targetFreq = freqFromHz(freqHz, currentMode);
   int targetBfo = isSSB() ? bfoFromHz(freqHz) : 0;
   if(!isFreqInBand(band, targetFreq) || (isSSB() && targetFreq == band->maximumFreq && targetBfo))
-    return remoteShowError(stream, "Frequency is out of range for the current band");
+    return "Frequency is out of range for the current band";
   if(!updateFrequency(targetFreq, false))
-    return remoteShowError(stream, "Frequency is out of range for the current band");
+    return "Frequency is out of range for the current band";
 
   if(isSSB())
     updateBFO(targetBfo, false);
@@ -152,33 +93,35 @@ static bool remoteSetFrequency(Stream *stream)
   clearStationInfo();
   identifyFrequency(currentFrequency + currentBFO / 1000);
 
-  return true;
+  return NULL;
 }
 
-static void remoteGetMemories(Stream* stream)
+static bool remoteSetFrequency(Stream *stream, const char *line)
 {
-  for (uint8_t i = 0; i < getTotalMemories(); i++) {
-    if (memories[i].freq) {
-      stream->printf("#%02d,%s,%ld,%s\r\n", i + 1, bands[memories[i].band].bandName, memories[i].freq, bandModeDesc[memories[i].mode]);
-    }
-  }
+  long int freqHz = remoteParseInteger(&line);
+  if(freqHz <= 0)
+    return remoteShowError(stream, "Invalid frequency");
+  if(*line)
+    return remoteShowError(stream, "Expected newline");
+
+  const char *error = remoteTuneFrequency(freqHz);
+  return error ? remoteShowError(stream, error) : true;
 }
 
-static bool remoteSetMemory(Stream* stream)
+static bool remoteSetMemory(Stream* stream, const char *line)
 {
-  stream->print('#');
   Memory mem;
   uint32_t freq = 0;
 
-  long int slot = remoteReadInteger(stream);
-  if (remoteReadChar(stream) != ',')
+  long int slot = remoteParseInteger(&line);
+  if (!remoteParseChar(&line, ','))
     return remoteShowError(stream, "Expected ','");
   if (slot < 1 || slot > getTotalMemories())
     return remoteShowError(stream, "Invalid memory slot number");
 
   char band[8];
-  remoteReadString(stream, band, 8);
-  if (remoteReadChar(stream) != ',')
+  remoteParseString(&line, band, 8);
+  if (!remoteParseChar(&line, ','))
     return remoteShowError(stream, "Expected ','");
   mem.band = 0xFF;
   for (int i = 0; i < getTotalBands(); i++) {
@@ -190,15 +133,14 @@ static bool remoteSetMemory(Stream* stream)
   if (mem.band == 0xFF)
     return remoteShowError(stream, "No such band");
 
-  freq = remoteReadInteger(stream);
-  if (remoteReadChar(stream) != ',')
+  freq = remoteParseInteger(&line);
+  if (!remoteParseChar(&line, ','))
     return remoteShowError(stream, "Expected ','");
 
   char mode[4];
-  remoteReadString(stream, mode, 4);
-  if (!expectNewline(stream))
+  remoteParseString(&line, mode, 4);
+  if (*line)
     return remoteShowError(stream, "Expected newline");
-  stream->println();
   mem.mode = 15;
   for (int i = 0; i < getTotalModes(); i++) {
     if (strcmp(bandModeDesc[i], mode) == 0) {
@@ -237,34 +179,45 @@ static bool remoteSetMemory(Stream* stream)
 }
 
 //
-// Set current color theme from the remote
+// Run stored script, or stop the running one if no name is given
 //
-static void remoteSetColorTheme(Stream* stream)
+static void remoteRunScript(Stream* stream, const char *name)
 {
-  stream->print("Enter a string of hex colors (x0001x0002...): ");
+  if(!*name)
+  {
+    stream->println(scriptRunning() ? "Script stopped" : "No script is running");
+    scriptStop();
+    return;
+  }
+
+  const char *error = scriptRun(name);
+  if(error)
+    remoteShowError(stream, error);
+  else
+    stream->println("Script started");
+}
 
+//
+// Set current color theme from the remote
+//
+static void remoteSetColorTheme(Stream* stream, const char *line)
+{
   uint8_t *p = (uint8_t *)&(TH.bg);
 
-  for(int i=0 ; ; i+=sizeof(uint16_t))
+  for(unsigned int i=0 ; i<sizeof(ColorTheme)-offsetof(ColorTheme, bg) ; i+=sizeof(uint16_t), line+=5)
   {
-    if(i >= sizeof(ColorTheme)-offsetof(ColorTheme, bg))
-    {
-      stream->println(" Ok");
-      break;
-    }
-
-    if(remoteReadChar(stream) != 'x')
+    if((line[0] != 'x') || !isxdigit(line[1]) || !isxdigit(line[2]) || !isxdigit(line[3]) || !isxdigit(line[4]))
     {
       stream->println(" Err");
-      break;
+      return;
     }
 
-    p[i + 1]  = char2nibble(remoteReadChar(stream)) * 16;
-    p[i + 1] |= char2nibble(remoteReadChar(stream));
-    p[i]      = char2nibble(remoteReadChar(stream)) * 16;
-    p[i]     |= char2nibble(remoteReadChar(stream));
+    p[i + 1] = char2nibble(line[1]) * 16 + char2nibble(line[2]);
+    p[i]     = char2nibble(line[3]) * 16 + char2nibble(line[4]);
   }
 
+  stream->println(" Ok");
+
   // Redraw screen
   drawScreen();
 }
@@ -277,7 +230,7 @@ static void remoteGetColorTheme(Stream* stream)
   stream->printf("Color theme %s: ", TH.name);
   const uint8_t *p = (uint8_t *)&(TH.bg);
 
-  for(int i=0 ; i<sizeof(ColorTheme)-offsetof(ColorTheme, bg) ; i+=sizeof(uint16_t))
+  for(unsigned int i=0 ; i<sizeof(ColorTheme)-offsetof(ColorTheme, bg) ; i+=sizeof(uint16_t))
   {
     stream->printf("x%02X%02X", p[i+1], p[i]);
   }
@@ -286,58 +239,458 @@ static void remoteGetColorTheme(Stream* stream)
 }
 
 //
-// Print current status to the remote
+// Append formatted text to the output queue
+//
+static void remoteQueuePrintf(RemoteState* state, const char *format, ...)
+{
+  uint16_t room = REMOTE_QUEUE_SIZE - state->remoteQueueLen;
+  va_list args;
+
+  va_start(args, format);
+  int size = vsnprintf((char *)state->remoteQueue + state->remoteQueueLen, room, format, args);
+  va_end(args);
+
+  if(size > 0) state->remoteQueueLen += min(size, room - 1);
+}
+
+//
+// Capture current screen image to the remote as a hex encoded BMP,
+// the header first, then up to REMOTE_HEX_PIXELS pixels per call
+//
+#define REMOTE_HEX_PIXELS 128
+
+static bool remoteCaptureStep(RemoteState* state)
+{
+  uint16_t width  = spr.width();
+  uint16_t height = spr.height();
+
+  if(!state->remoteJobPos)
+  {
+    remoteQueuePrintf(state,
+      "\r\n424d%08x00000000%08x" // BM, image size, offset to image data
+      "28000000%08x%08x"         // Image header size, width, height
+      "01001000"                 // 1 plane, 16 bpp
+      "03000000"                 // Compression
+      "00000000"                 // Compressed image size
+      "0000000000000000"         // X and Y res
+      "0000000000000000"         // Color map, colors
+      "00f80000e00700001f000000" // Red, green, and blue masks
+      "\r\n",
+      (unsigned int)htonl(14 + 40 + 12 + width * height * 2),
+      (unsigned int)htonl(14 + 40 + 12),
+      (unsigned int)htonl(width),
+      (unsigned int)htonl(height)
+    );
+    state->remoteJobPos++;
+    return(true);
+  }
+
+  // Image data, bottom to top
+  uint32_t pixel = state->remoteJobPos - 1;
+  if(pixel >= (uint32_t)width * height) return(false);
+
+  int y = height - 1 - pixel / width;
+  int x = pixel % width;
+  int count = min(width - x, REMOTE_HEX_PIXELS);
+
+  for(int i=0 ; i<count ; i++)
+    remoteQueuePrintf(state, "%04x", htons(spr.readPixel(x + i, y)));
+  if(x + count >= width)
+    remoteQueuePrintf(state, "\r\n");
+
+  state->remoteJobPos += count;
+  return(true);
+}
+
+//
+// Capture current screen image to the remote as a compressed
+// binary stream: "ATSC" header, one length-prefixed RLE chunk
+// with CRC per row, and a zero-length terminator
+//
+static bool remoteCaptureRLEStep(RemoteState* state)
+{
+  uint16_t width  = spr.width();
+  uint16_t height = spr.height();
+  const uint16_t *pixels = (const uint16_t *)spr.getPointer();
+  uint8_t *out = state->remoteQueue;
+  uint32_t row = state->remoteJobPos++;
+
+  if(!row)
+  {
+    // Header: magic, version, pixel format (RGB565, big-endian), size
+    const uint8_t header[] =
+    {
+      'A', 'T', 'S', 'C', 1, 1,
+      (uint8_t)width, (uint8_t)(width >> 8),
+      (uint8_t)height, (uint8_t)(height >> 8)
+    };
+    memcpy(out, header, sizeof(header));
+    state->remoteQueueLen = sizeof(header);
+    return(true);
+  }
+
+  // Zero-length terminator
+  if(row > height)
+  {
+    if(row > height + 1U) return(false);
+    out[0] = out[1] = 0;
+    state->remoteQueueLen = 2;
+    return(true);
+  }
+
+  // Image data, top to bottom
+  uint16_t size = rleEncode(pixels + (row - 1) * width, width, out + 2);
+  uint16_t crc  = crc16(out + 2, size);
+  out[0] = (uint8_t)size;
+  out[1] = (uint8_t)(size >> 8);
+  out[size + 2] = (uint8_t)crc;
+  out[size + 3] = (uint8_t)(crc >> 8);
+  state->remoteQueueLen = size + 4;
+  return(true);
+}
+
+//
+// List memories to the remote, one used slot per call
+//
+static bool remoteMemoriesStep(RemoteState* state)
+{
+  uint32_t count = getTotalMemories();
+
+  while((state->remoteJobPos < count) && !memories[state->remoteJobPos].freq)
+    state->remoteJobPos++;
+  if(state->remoteJobPos >= count) return(false);
+
+  const Memory *mem = &memories[state->remoteJobPos++];
+  remoteQueuePrintf(state, "#%02d,%s,%ld,%s\r\n", (int)state->remoteJobPos, bands[mem->band].bandName, mem->freq, bandModeDesc[mem->mode]);
+  return(true);
+}
+
+//
+// Produce the next piece of the job output into the empty queue,
+// return false when the job is done
+//
+static bool remoteJobStep(RemoteState* state)
+{
+  switch(state->remoteJob)
+  {
+    case REMOTE_JOB_CAPTURE:     return(remoteCaptureStep(state));
+    case REMOTE_JOB_CAPTURE_RLE: return(remoteCaptureRLEStep(state));
+    case REMOTE_JOB_MEMORIES:    return(remoteMemoriesStep(state));
+  }
+  return(false);
+}
+
+static void remoteStopJob(RemoteState* state)
+{
+  free(state->remoteQueue);
+  state->remoteQueue    = NULL;
+  state->remoteQueueLen = 0;
+  state->remoteQueuePos = 0;
+  state->remoteJob      = REMOTE_JOB_NONE;
+}
+
+//
+// Start a long running command, its output is sent by remoteRunJob()
+//
+static void remoteStartJob(Stream* stream, RemoteState* state, uint8_t job)
+{
+  if((job == REMOTE_JOB_CAPTURE_RLE) && (!spr.getPointer() || (RLE_MAX_SIZE(spr.width()) + 4 > REMOTE_QUEUE_SIZE)))
+  {
+    stream->println("\r\nScreenshot failed, out of memory");
+    return;
+  }
+
+  if(!state->remoteQueue) state->remoteQueue = (uint8_t *)malloc(REMOTE_QUEUE_SIZE);
+  if(!state->remoteQueue)
+  {
+    remoteShowError(stream, "Out of memory");
+    return;
+  }
+
+  state->remoteJob      = job;
+  state->remoteJobPos   = 0;
+  state->remoteJobStart = state->remoteJobTime = millis();
+  state->remoteQueueLen = 0;
+  state->remoteQueuePos = 0;
+}
+
+//
+// Send queued output as far as the client takes it without blocking,
+// producing more until the job is done. At most REMOTE_QUEUE_SIZE
+// bytes are sent per call, so that a fast client can not hold up
+// the others.
+//
+static void remoteRunJob(Stream* stream, RemoteState* state)
+{
+  uint16_t budget = REMOTE_QUEUE_SIZE;
+
+  while(budget)
+  {
+    if(state->remoteQueuePos >= state->remoteQueueLen)
+    {
+      state->remoteQueueLen = state->remoteQueuePos = 0;
+      if(!remoteJobStep(state))
+      {
+        remoteStopJob(state);
+        return;
+      }
+    }
+
+    // Back-pressure: wait for the client to take earlier output,
+    // give up on clients that stopped reading
+    int room = stream->availableForWrite();
+    size_t size = room <= 0? 0 :
+      min(min((uint16_t)room, budget), (uint16_t)(state->remoteQueueLen - state->remoteQueuePos));
+    if(size) size = stream->write(state->remoteQueue + state->remoteQueuePos, size);
+    if(!size)
+    {
+      if((millis() - state->remoteJobTime) > REMOTE_JOB_TIMEOUT) remoteStopJob(state);
+      return;
+    }
+
+    state->remoteJobTime = millis();
+    state->remoteQueuePos += size;
+    budget -= size;
+  }
+}
+
+//
+// Format current status without the sequence number
+//
+static int remoteFormatStatus(char *buf, size_t size)
+{
+  // Hardware readings come from the shared snapshot
+  telemetryReadAntCap();
+  const Telemetry *tlm = telemetryGet();
+
+  return snprintf(buf, size, "%u,%u,%d,%d,%s,%s,%s,%s,%hu,%hu,%hu,%hu,%hu,%.2f",
+                  VER_APP,
+                  currentFrequency,
+                  currentBFO,
+                  ((currentMode == USB) ? getCurrentBand()->usbCal :
+                   (currentMode == LSB) ? getCurrentBand()->lsbCal : 0),
+                  getCurrentBand()->bandName,
+                  bandModeDesc[currentMode],
+                  getCurrentStep()->desc,
+                  getCurrentBandwidth()->desc,
+                  agcIdx,
+                  volume,
+                  tlm->rssi,
+                  tlm->snr,
+                  tlm->antCap,
+                  tlm->voltage
+                  );
+}
+
+//
+// Session table, one session per connected ad hoc protocol client
+//
+typedef struct {
+  Stream *stream;                  // NULL if the slot is free
+  RemoteState *state;
+} RemoteSession;
+
+static RemoteSession remoteSessions[REMOTE_MAX_SESSIONS];
+static uint8_t remoteNext = 0;     // Session to execute a command first
+
 //
-void remotePrintStatus(Stream* stream, RemoteState* state)
+// Start serving a client, does nothing if it is served already
+//
+void remoteOpen(Stream* stream, RemoteState* state)
 {
-  // Prepare information ready to be sent
-  float remoteVoltage = batteryMonitor();
+  RemoteSession *slot = NULL;
 
-  // S-Meter conditional on compile option
-  rx.getCurrentReceivedSignalQuality();
-  uint8_t remoteRssi = rx.getCurrentRSSI();
-  uint8_t remoteSnr = rx.getCurrentSNR();
+  for(int j=0 ; j<REMOTE_MAX_SESSIONS ; j++)
+  {
+    if(remoteSessions[j].state == state) return;
+    if(!slot && !remoteSessions[j].stream) slot = &remoteSessions[j];
+  }
 
-  // Use rx.getFrequency to force read of capacitor value from SI4732/5
-  rx.getFrequency();
-  uint16_t tuningCapacitor = rx.getAntennaTuningCapacitor();
+  // Table is full, the client is not served
+  if(!slot) return;
 
-  // Remote serial
-  stream->printf("%u,%u,%d,%d,%s,%s,%s,%s,%hu,%hu,%hu,%hu,%hu,%.2f,%hu\r\n",
-                VER_APP,
-                currentFrequency,
-                currentBFO,
-                ((currentMode == USB) ? getCurrentBand()->usbCal :
-                 (currentMode == LSB) ? getCurrentBand()->lsbCal : 0),
-                getCurrentBand()->bandName,
-                bandModeDesc[currentMode],
-                getCurrentStep()->desc,
-                getCurrentBandwidth()->desc,
-                agcIdx,
-                volume,
-                remoteRssi,
-                remoteSnr,
-                tuningCapacitor,
-                remoteVoltage,
-                state->remoteSeqnum
-                );
+  *state = RemoteState();
+  slot->stream = stream;
+  slot->state  = state;
 }
 
 //
-// Tick remote time, periodically printing status
+// Stop serving a client, dropping its unsent output
 //
-void remoteTickTime(Stream* stream, RemoteState* state)
+void remoteClose(RemoteState* state)
 {
-  if(state->remoteLogOn && (millis() - state->remoteTimer >= 500))
+  for(int j=0 ; j<REMOTE_MAX_SESSIONS ; j++)
   {
-    // Mark time and increment diagnostic sequence number
-    state->remoteTimer = millis();
+    if(remoteSessions[j].state != state) continue;
+    remoteStopJob(state);
+    remoteSessions[j].stream = NULL;
+    remoteSessions[j].state  = NULL;
+  }
+}
+
+//
+// Return true while a screenshot is being sent, so that background
+// changes are not drawn under it, for a limited time
+//
+bool remoteCapturing()
+{
+  for(int j=0 ; j<REMOTE_MAX_SESSIONS ; j++)
+  {
+    RemoteSession *session = &remoteSessions[j];
+    if(session->stream &&
+       ((session->state->remoteJob == REMOTE_JOB_CAPTURE) ||
+        (session->state->remoteJob == REMOTE_JOB_CAPTURE_RLE)) &&
+       ((millis() - session->state->remoteJobStart) < REMOTE_CAPTURE_HOLD))
+      return(true);
+  }
+
+  return(false);
+}
+
+//
+// Periodically send status to the sessions that asked for it,
+// the status line is formatted once and shared between them
+//
+static void remoteTickTime()
+{
+  static uint32_t remoteTimer = 0;
+  char status[128];
+  int length = -1;
+
+  if(millis() - remoteTimer < REMOTE_STATUS_TIME) return;
+  remoteTimer = millis();
+
+  for(int j=0 ; j<REMOTE_MAX_SESSIONS ; j++)
+  {
+    Stream *stream = remoteSessions[j].stream;
+    RemoteState *state = remoteSessions[j].state;
+
+    // Do not interleave status with a command line or long output
+    if(!stream || !state->remoteLogOn || state->remoteCmd || state->remoteJob) continue;
+
+    // Increment diagnostic sequence number, the line is skipped
+    // if the client does not keep up, leaving a gap in the numbers
     state->remoteSeqnum++;
-    // Show status
-    remotePrintStatus(stream, state);
+    if(length < 0) length = min(remoteFormatStatus(status, sizeof(status)), (int)sizeof(status) - 1);
+    if(stream->availableForWrite() < length + 8) continue;
+
+    stream->write((const uint8_t *)status, length);
+    stream->printf(",%hu\r\n", state->remoteSeqnum);
   }
 }
 
+//
+// Start receiving a command line for the given command
+//
+static void remoteBeginLine(Stream* stream, RemoteState* state, char key)
+{
+  if(key != '^') stream->print(key);
+
+  state->remoteCmd      = key;
+  state->remoteOverflow = false;
+  state->remoteLineLen  = 0;
+  state->remoteLineTime = millis();
+}
+
+//
+// Return true if the command line has been received completely
+// without waiting for the newline
+//
+static bool remoteLineComplete(RemoteState* state)
+{
+  // Color theme has fixed length
+  return(
+    (state->remoteCmd == '^') &&
+    (state->remoteLineLen >= (sizeof(ColorTheme) - offsetof(ColorTheme, bg)) / sizeof(uint16_t) * 5)
+  );
+}
+
+//
+// Execute fully received command line
+//
+static int remoteDoLine(Stream* stream, RemoteState* state)
+{
+  char cmd = state->remoteCmd;
+  int event = 0;
+
+  state->remoteCmd = 0;
+  state->remoteLine[state->remoteLineLen] = '\0';
+
+  if(state->remoteOverflow)
+  {
+    remoteShowError(stream, "Line is too long");
+    return(event);
+  }
+
+  switch(cmd)
+  {
+    case '#':
+      stream->println();
+      if (remoteSetMemory(stream, state->remoteLine))
+        event |= REMOTE_PREFS;
+      break;
+    case 'F':
+      stream->println();
+      if (remoteSetFrequency(stream, state->remoteLine))
+        event |= REMOTE_PREFS;
+      break;
+    case 'X':
+      stream->println();
+      remoteRunScript(stream, state->remoteLine);
+      break;
+    case '^':
+      remoteSetColorTheme(stream, state->remoteLine);
+      break;
+  }
+
+  return(event | REMOTE_CHANGED);
+}
+
+//
+// Receive available remote input without blocking. Single character
+// commands are executed immediately, commands with arguments are
+// accumulated across calls and executed once the whole line arrives.
+// At most one command is executed per call.
+//
+int remoteReceive(Stream* stream, RemoteState* state)
+{
+  while(stream->available())
+  {
+    char ch = stream->read();
+
+    // Single character command or start of a command line
+    if(!state->remoteCmd)
+      return(remoteDoCommand(stream, state, ch));
+
+    state->remoteLineTime = millis();
+
+    // Newline terminates the command line, LF after CR is
+    // taken for an unknown command and ignored
+    if((ch == '\r') || (ch == '\n'))
+      return(remoteDoLine(stream, state));
+
+    if(state->remoteLineLen >= REMOTE_LINE_SIZE - 1)
+      state->remoteOverflow = true;
+    else
+    {
+      state->remoteLine[state->remoteLineLen++] = ch;
+      stream->print(ch);
+    }
+
+    if(remoteLineComplete(state))
+      return(remoteDoLine(stream, state));
+  }
+
+  // Drop incomplete command line from a stalled client
+  if(state->remoteCmd && ((millis() - state->remoteLineTime) > REMOTE_LINE_TIMEOUT))
+  {
+    state->remoteCmd = 0;
+    remoteShowError(stream, "Timeout");
+  }
+
+  return(0);
+}
+
 //
 // Recognize and execute given remote command
 //
@@ -433,30 +786,41 @@ int remoteDoCommand(Stream* stream, RemoteState* state, char key)
       break;
     case 'C':
       state->remoteLogOn = false;
-      remoteCaptureScreen(stream);
+      remoteStartJob(stream, state, REMOTE_JOB_CAPTURE);
+      break;
+    case 'c':
+      state->remoteLogOn = false;
+      remoteStartJob(stream, state, REMOTE_JOB_CAPTURE_RLE);
       break;
     case 't':
       state->remoteLogOn = !state->remoteLogOn;
       break;
+    case 'P':
+      profilePrint(stream);
+      break;
+    case 'p':
+      state->remoteLogOn = false;
+      profileBenchmark(stream);
+      break;
 
     case '$':
-      remoteGetMemories(stream);
+      remoteStartJob(stream, state, REMOTE_JOB_MEMORIES);
       break;
     case '#':
-      if (remoteSetMemory(stream))
-        event |= REMOTE_PREFS;
-      break;
     case 'F':
-      if (remoteSetFrequency(stream))
-        event |= REMOTE_PREFS;
-      break;
+    case 'X':
+      // Arguments are received by remoteReceive()
+      remoteBeginLine(stream, state, key);
+      return(event);
 
     case 'T':
       stream->println(switchThemeEditor(!switchThemeEditor()) ? "Theme editor enabled" : "Theme editor disabled");
       break;
     case '^':
-      if(switchThemeEditor()) remoteSetColorTheme(stream);
-      break;
+      if(!switchThemeEditor()) break;
+      stream->print("Enter a string of hex colors (x0001x0002...): ");
+      remoteBeginLine(stream, state, key);
+      return(event);
     case '@':
       if(switchThemeEditor()) remoteGetColorTheme(stream);
       break;
@@ -470,14 +834,55 @@ int remoteDoCommand(Stream* stream, RemoteState* state, char key)
   return(event | REMOTE_CHANGED);
 }
 
+//
+// Serve ad hoc protocol sessions: send queued output, send status,
+// and execute one command. Sessions take turns executing commands,
+// so every client is served within a few loop passes regardless
+// of what the others are doing.
+//
+int remoteLoop()
+{
+  for(int j=0 ; j<REMOTE_MAX_SESSIONS ; j++)
+    if(remoteSessions[j].stream && remoteSessions[j].state->remoteJob)
+      remoteRunJob(remoteSessions[j].stream, remoteSessions[j].state);
+
+  remoteTickTime();
+
+  for(int i=0 ; i<REMOTE_MAX_SESSIONS ; i++)
+  {
+    uint8_t j = (remoteNext + i) % REMOTE_MAX_SESSIONS;
+    RemoteSession *session = &remoteSessions[j];
+
+    // Input waits until the long output has been sent
+    if(!session->stream || session->state->remoteJob) continue;
+
+    int event = remoteReceive(session->stream, session->state);
+    if(event)
+    {
+      remoteNext = (j + 1) % REMOTE_MAX_SESSIONS;
+      return(event);
+    }
+  }
+
+  return(0);
+}
+
 static int serialLoop(Stream* stream, RemoteState* state, uint8_t usbMode)
 {
-  if(usbMode == USB_OFF) return 0;
+  // Ad hoc commands are executed by remoteLoop()
+  if(usbMode == USB_ADHOC)
+    remoteOpen(stream, state);
+  else
+    remoteClose(state);
+
+  if(usbMode == USB_BINARY)
+  {
+    binaryTickTime(stream, &binarySerialState);
+    return binaryReceive(stream, &binarySerialState);
+  }
 
-  remoteTickTime(stream, state);
+  if(usbMode == USB_CAT) return catReceive(stream, &catSerialState);
 
-  if (stream->available())
-    return remoteDoCommand(stream, state, stream->read());
   return 0;
 }
 
@@ -488,7 +893,13 @@ int serialLoop(uint8_t usbMode)
 
 bool serialConsumeAbortPending(uint8_t usbMode)
 {
-  if(usbMode == USB_OFF || !Serial.available()) return false;
+  // Binary frames must not lose bytes, only ad hoc input aborts
+  if(usbMode != USB_ADHOC || !Serial.available()) return false;
   Serial.read();
   return true;
 }
+
+uint16_t serialSamplePeriod(uint8_t usbMode)
+{
+  return(usbMode == USB_BINARY ? binarySamplePeriod(&binarySerialState) : 0);
+}
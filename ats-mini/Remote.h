@@ -1,15 +1,48 @@
 #ifndef REMOTE_H
 #define REMOTE_H
 
+#define REMOTE_LINE_SIZE    256  // Maximum command line length
+#define REMOTE_MAX_SESSIONS   8  // USB, Bluetooth, and network clients
+#define REMOTE_QUEUE_SIZE  1024  // Output queue of a long running command
+#define REMOTE_STATUS_TIME  500  // Time between status lines (ms)
+
+// Long running commands, their output is produced in pieces
+// and sent as the client takes it
+#define REMOTE_JOB_NONE        0
+#define REMOTE_JOB_CAPTURE     1 // 'C' hex screenshot
+#define REMOTE_JOB_CAPTURE_RLE 2 // 'c' compressed screenshot
+#define REMOTE_JOB_MEMORIES    3 // '$' memory list
+
 typedef struct {
-  uint32_t remoteTimer = millis();
   uint8_t remoteSeqnum = 0;
   bool remoteLogOn = false;
+
+  // Multi-character command being received
+  char remoteCmd = 0;              // Command letter, 0 if none
+  bool remoteOverflow = false;     // Line is too long, skipping it
+  uint16_t remoteLineLen = 0;      // Characters received so far
+  uint32_t remoteLineTime = 0;     // Time the last character was received
+  char remoteLine[REMOTE_LINE_SIZE];
+
+  // Long running command output
+  uint8_t remoteJob = REMOTE_JOB_NONE;
+  uint32_t remoteJobPos = 0;       // Next pixel, row, or memory slot
+  uint32_t remoteJobStart = 0;     // Time the job started
+  uint32_t remoteJobTime = 0;      // Time the client last took output
+  uint8_t *remoteQueue = NULL;     // Allocated while the job runs
+  uint16_t remoteQueueLen = 0;     // Bytes in the queue
+  uint16_t remoteQueuePos = 0;     // Bytes already sent
 } RemoteState;
 
-void remoteTickTime(Stream* stream, RemoteState* state);
+void remoteOpen(Stream* stream, RemoteState* state);
+void remoteClose(RemoteState* state);
+int remoteLoop();
+bool remoteCapturing();
 int remoteDoCommand(Stream* stream, RemoteState* state, char key);
+int remoteReceive(Stream* stream, RemoteState* state);
+const char *remoteTuneFrequency(uint32_t freqHz);
 int serialLoop(uint8_t usbMode);
 bool serialConsumeAbortPending(uint8_t usbMode);
+uint16_t serialSamplePeriod(uint8_t usbMode);
 
 #endif
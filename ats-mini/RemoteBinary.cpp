@@ -0,0 +1,529 @@
+#include "Common.h"
+#include "Utils.h"
+#include "Menu.h"
+#include "Remote.h"
+#include "RemoteBinary.h"
+#include "Telemetry.h"
+#include "Storage.h"
+#include "Script.h"
+
+// SLIP special characters
+#define SLIP_END      0xC0
+#define SLIP_ESC      0xDB
+#define SLIP_ESC_END  0xDC
+#define SLIP_ESC_ESC  0xDD
+
+// Frame id, opcode, and CRC
+#define BIN_OVERHEAD  5
+
+static_assert(BIN_FRAME_SIZE >= BIN_OVERHEAD + 1 + MEMORY_COUNT * sizeof(Memory), "Memory table must fit into a frame");
+static_assert(BIN_FRAME_SIZE >= BIN_OVERHEAD + SCRIPT_NAME_SIZE + SCRIPT_FILE_SIZE, "Largest script must fit into a frame");
+
+// Ad hoc commands that only simulate user input and print nothing
+static const char binaryKeys[] = "RreEBbMmSsWwAaVvLlOoIi";
+
+static void binaryPut16(uint8_t *p, uint16_t value)
+{
+  p[0] = value;
+  p[1] = value >> 8;
+}
+
+static void binaryPut32(uint8_t *p, uint32_t value)
+{
+  binaryPut16(p, value);
+  binaryPut16(p + 2, value >> 16);
+}
+
+static uint16_t binaryGet16(const uint8_t *p)
+{
+  return(p[0] | (p[1] << 8));
+}
+
+static uint32_t binaryGet32(const uint8_t *p)
+{
+  return(binaryGet16(p) | ((uint32_t)binaryGet16(p + 2) << 16));
+}
+
+//
+// SLIP encode and send a part of the frame, updating its CRC
+//
+static void binaryWrite(Stream* stream, const uint8_t *data, size_t size, uint16_t *crc)
+{
+  uint8_t out[64];
+  uint16_t length = 0;
+
+  if(crc) *crc = crc16(data, size, *crc);
+
+  for(size_t i=0 ; i<size ; i++)
+  {
+    // Flush output buffer when an escaped byte may not fit
+    if(length >= sizeof(out) - 1)
+    {
+      stream->write(out, length);
+      length = 0;
+    }
+
+    switch(data[i])
+    {
+      case SLIP_END:
+        out[length++] = SLIP_ESC;
+        out[length++] = SLIP_ESC_END;
+        break;
+      case SLIP_ESC:
+        out[length++] = SLIP_ESC;
+        out[length++] = SLIP_ESC_ESC;
+        break;
+      default:
+        out[length++] = data[i];
+        break;
+    }
+  }
+
+  if(length) stream->write(out, length);
+}
+
+//
+// Send a SLIP encoded frame to the remote, the payload may be
+// given in two parts to avoid copying large tables
+//
+static void binarySend(Stream* stream, uint16_t id, uint8_t opcode, const uint8_t *payload, size_t size, const uint8_t *extra = NULL, size_t extraSize = 0)
+{
+  uint8_t header[3];
+  uint8_t trailer[2];
+  uint16_t crc = 0xFFFF;
+
+  binaryPut16(header, id);
+  header[2] = opcode;
+
+  // Leading END flushes any line noise on the receiving side
+  stream->write((uint8_t)SLIP_END);
+  binaryWrite(stream, header, sizeof(header), &crc);
+  binaryWrite(stream, payload, size, &crc);
+  if(extra) binaryWrite(stream, extra, extraSize, &crc);
+  binaryPut16(trailer, crc);
+  binaryWrite(stream, trailer, sizeof(trailer), NULL);
+  stream->write((uint8_t)SLIP_END);
+}
+
+static void binarySendError(Stream* stream, uint16_t id, uint8_t code, const char *message)
+{
+  uint8_t payload[64];
+  uint16_t size = min(strlen(message), sizeof(payload) - 1);
+
+  payload[0] = code;
+  memcpy(payload + 1, message, size);
+  binarySend(stream, id, BIN_ERROR, payload, size + 1);
+}
+
+//
+// Fill in the status record, returns its size:
+//   u16 firmware version, u32 frequency (Hz), i16 calibration,
+//   u8 band index, u8 mode, u8 step index, u8 bandwidth index,
+//   i8 AGC/attenuation index, u8 volume, u8 RSSI, u8 SNR,
+//   u16 antenna tuning capacitor, u16 battery voltage (mV)
+//
+static uint16_t binaryGetStatus(uint8_t *p)
+{
+  const Band *band = getCurrentBand();
+  telemetryReadAntCap();
+  const Telemetry *tlm = telemetryGet();
+
+  binaryPut16(p + 0, VER_APP);
+  binaryPut32(p + 2, freqToHz(currentFrequency, currentMode) + currentBFO);
+  binaryPut16(p + 6, currentMode == USB ? band->usbCal : currentMode == LSB ? band->lsbCal : 0);
+  p[8]  = bandIdx;
+  p[9]  = currentMode;
+  p[10] = band->currentStepIdx;
+  p[11] = band->bandwidthIdx;
+  p[12] = agcIdx;
+  p[13] = volume;
+  p[14] = tlm->rssi;
+  p[15] = tlm->snr;
+  binaryPut16(p + 16, tlm->antCap);
+  binaryPut16(p + 18, tlm->voltage * 1000);
+  return(20);
+}
+
+//
+// Validate a whole memory table, put error message into the
+// given buffer (32 bytes) if it is invalid
+//
+static bool binaryCheckMemories(const Memory *table, uint8_t *error)
+{
+  for(int i=0 ; i<getTotalMemories() ; i++)
+  {
+    const Memory *mem = &table[i];
+
+    // Zero frequency marks an empty slot
+    if(!mem->freq) continue;
+
+    if(mem->band >= getTotalBands() || mem->mode >= getTotalModes() || !isMemoryInBand(&bands[mem->band], mem))
+    {
+      sprintf((char *)error, "Invalid memory slot %d", i + 1);
+      return(false);
+    }
+  }
+
+  return(true);
+}
+
+//
+// Replace memory table with the validated one, writing only the
+// changed slots to the preferences in a single session. Returns
+// the number of changed slots.
+//
+static uint8_t binaryImportMemories(const Memory *table)
+{
+  uint8_t changed = 0;
+
+  prefs.begin("memories", false, STORAGE_PARTITION);
+
+  for(int i=0 ; i<getTotalMemories() ; i++)
+  {
+    Memory mem = table[i];
+    mem.name[sizeof(mem.name) - 1] = '\0';
+    if(!memcmp(&mem, &memories[i], sizeof(mem))) continue;
+
+    memories[i] = mem;
+    prefsSaveMemory(i, false);
+    changed++;
+  }
+
+  prefs.end();
+
+  // Memory page is cached by the browser until the state changes
+  if(changed) webStateChanged();
+  return(changed);
+}
+
+//
+// Execute a request and send the reply, returns remote event
+//
+static int binaryDoRequest(Stream* stream, BinaryState* state, uint16_t id, uint8_t opcode, const uint8_t *payload, uint16_t size)
+{
+  uint8_t reply[32];
+  uint16_t replySize = 0;
+  const uint8_t *replyExtra = NULL;
+  size_t replyExtraSize = 0;
+  int event = 0;
+
+  switch(opcode)
+  {
+    case BIN_PING:
+      binaryPut16(reply, VER_APP);
+      replySize = 2;
+      break;
+
+    case BIN_GET_STATUS:
+      replySize = binaryGetStatus(reply);
+      break;
+
+    case BIN_KEY:
+      if(size != 1)
+      {
+        binarySendError(stream, id, BIN_ERR_LENGTH, "Expected key");
+        return(0);
+      }
+      if(!payload[0] || !strchr(binaryKeys, payload[0]))
+      {
+        binarySendError(stream, id, BIN_ERR_ARGUMENT, "Unsupported key");
+        return(0);
+      }
+      // Listed commands neither print nor use the ad hoc state
+      event = remoteDoCommand(stream, NULL, payload[0]);
+      binaryPut16(reply, event);
+      replySize = 2;
+      break;
+
+    case BIN_SET_FREQ:
+    {
+      if(size != 4)
+      {
+        binarySendError(stream, id, BIN_ERR_LENGTH, "Expected frequency");
+        return(0);
+      }
+      const char *error = remoteTuneFrequency(binaryGet32(payload));
+      if(error)
+      {
+        binarySendError(stream, id, BIN_ERR_ARGUMENT, error);
+        return(0);
+      }
+      event = REMOTE_CHANGED | REMOTE_PREFS;
+      break;
+    }
+
+    case BIN_GET_MEMORY:
+      if(size != 1)
+      {
+        binarySendError(stream, id, BIN_ERR_LENGTH, "Expected slot");
+        return(0);
+      }
+      if(payload[0] < 1 || payload[0] > getTotalMemories())
+      {
+        binarySendError(stream, id, BIN_ERR_ARGUMENT, "Invalid memory slot number");
+        return(0);
+      }
+      reply[0] = payload[0];
+      binaryPut32(reply + 1, memories[payload[0] - 1].freq);
+      reply[5] = memories[payload[0] - 1].band;
+      reply[6] = memories[payload[0] - 1].mode;
+      replySize = 7;
+      break;
+
+    case BIN_SET_MEMORY:
+    {
+      if(size != 7)
+      {
+        binarySendError(stream, id, BIN_ERR_LENGTH, "Expected memory");
+        return(0);
+      }
+      if(payload[0] < 1 || payload[0] > getTotalMemories())
+      {
+        binarySendError(stream, id, BIN_ERR_ARGUMENT, "Invalid memory slot number");
+        return(0);
+      }
+
+      Memory mem = memories[payload[0] - 1];
+      mem.freq = binaryGet32(payload + 1);
+      mem.band = payload[5];
+      mem.mode = payload[6];
+
+      // Zero frequency clears the slot
+      if(mem.freq && (mem.band >= getTotalBands() || mem.mode >= getTotalModes() || !isMemoryInBand(&bands[mem.band], &mem)))
+      {
+        binarySendError(stream, id, BIN_ERR_ARGUMENT, "Invalid frequency or mode");
+        return(0);
+      }
+
+      memories[payload[0] - 1] = mem;
+      event = REMOTE_CHANGED | REMOTE_PREFS;
+      break;
+    }
+
+    case BIN_MEM_EXPORT:
+      // Whole table straight from memory
+      reply[0] = getTotalMemories();
+      replySize = 1;
+      replyExtra = (const uint8_t *)memories;
+      replyExtraSize = getTotalMemories() * sizeof(Memory);
+      break;
+
+    case BIN_MEM_IMPORT:
+      if(size != 1 + getTotalMemories() * sizeof(Memory) || payload[0] != getTotalMemories())
+      {
+        binarySendError(stream, id, BIN_ERR_LENGTH, "Expected all memory slots");
+        return(0);
+      }
+      if(!binaryCheckMemories((const Memory *)(payload + 1), reply))
+      {
+        binarySendError(stream, id, BIN_ERR_ARGUMENT, (const char *)reply);
+        return(0);
+      }
+      reply[0] = binaryImportMemories((const Memory *)(payload + 1));
+      replySize = 1;
+      event = REMOTE_CHANGED;
+      break;
+
+    case BIN_SCRIPT_PUT:
+    {
+      // NUL terminated name, then the script text
+      const uint8_t *text = (const uint8_t *)memchr(payload, 0, size);
+      if(!text)
+      {
+        binarySendError(stream, id, BIN_ERR_LENGTH, "Expected script name");
+        return(0);
+      }
+      text++;
+      const char *error = scriptSave((const char *)payload, (const char *)text, size - (text - payload));
+      if(error)
+      {
+        binarySendError(stream, id, BIN_ERR_ARGUMENT, error);
+        return(0);
+      }
+      break;
+    }
+
+    case BIN_SCRIPT_RUN:
+    {
+      char name[SCRIPT_NAME_SIZE];
+      if(size >= sizeof(name))
+      {
+        binarySendError(stream, id, BIN_ERR_LENGTH, "Script name is too long");
+        return(0);
+      }
+      memcpy(name, payload, size);
+      name[size] = '\0';
+
+      // Empty name stops the running script
+      const char *error = size ? scriptRun(name) : NULL;
+      if(!size) scriptStop();
+      if(error)
+      {
+        binarySendError(stream, id, BIN_ERR_ARGUMENT, error);
+        return(0);
+      }
+      break;
+    }
+
+    case BIN_SUBSCRIBE:
+      if(size != 3)
+      {
+        binarySendError(stream, id, BIN_ERR_LENGTH, "Expected rate and fields");
+        return(0);
+      }
+      if(payload[0] > BIN_TLM_MAX_RATE)
+      {
+        binarySendError(stream, id, BIN_ERR_ARGUMENT, "Rate is too high");
+        return(0);
+      }
+      state->binaryTlmMask   = payload[0] ? binaryGet16(payload + 1) & BIN_TLM_ALL : 0;
+      state->binaryTlmPeriod = payload[0] ? 1000 / payload[0] : 0;
+      state->binaryTlmTime   = millis();
+      break;
+
+    default:
+      binarySendError(stream, id, BIN_ERR_OPCODE, "Unknown opcode");
+      return(0);
+  }
+
+  binarySend(stream, id, opcode | BIN_REPLY, reply, replySize, replyExtra, replyExtraSize);
+  return(event);
+}
+
+//
+// Send a telemetry record with the selected fields. Signal quality
+// comes from the last processRssiSnr() sample, no I2C reads here.
+//
+static void binarySendTelemetry(Stream* stream, BinaryState* state)
+{
+  const Telemetry *tlm = telemetryGet();
+  uint16_t mask = state->binaryTlmMask;
+  uint8_t record[16];
+  uint16_t size = 0;
+
+  binaryPut16(record, mask);
+  size += 2;
+
+  if(mask & BIN_TLM_TIME)
+  {
+    binaryPut32(record + size, millis());
+    size += 4;
+  }
+  if(mask & BIN_TLM_FREQ)
+  {
+    binaryPut16(record + size, currentFrequency);
+    size += 2;
+  }
+  if(mask & BIN_TLM_BFO)
+  {
+    binaryPut16(record + size, currentBFO);
+    size += 2;
+  }
+  if(mask & BIN_TLM_RSSI)
+    record[size++] = tlm->rssi;
+  if(mask & BIN_TLM_SNR)
+    record[size++] = tlm->snr;
+  if(mask & BIN_TLM_PILOT)
+    record[size++] = (currentMode == FM) && tlm->pilot;
+  if(mask & BIN_TLM_MUTE)
+    record[size++] = (muteOn(MUTE_MAIN) ? 1 : 0) | (muteOn(MUTE_SQUELCH) ? 2 : 0);
+
+  binarySend(stream, state->binaryTlmSeqnum++, BIN_TELEMETRY, record, size);
+}
+
+//
+// Tick binary remote time, sending subscribed telemetry
+//
+void binaryTickTime(Stream* stream, BinaryState* state)
+{
+  if(!state->binaryTlmMask) return;
+
+  if(millis() - state->binaryTlmTime >= state->binaryTlmPeriod)
+  {
+    // Keep the average rate if the loop was late
+    state->binaryTlmTime += state->binaryTlmPeriod;
+    if(millis() - state->binaryTlmTime >= state->binaryTlmPeriod)
+      state->binaryTlmTime = millis();
+    binarySendTelemetry(stream, state);
+  }
+}
+
+//
+// Return signal quality sampling period needed by the telemetry
+// subscription, or 0 if it does not include signal quality
+//
+uint16_t binarySamplePeriod(const BinaryState* state)
+{
+  const uint16_t fields = BIN_TLM_RSSI | BIN_TLM_SNR | BIN_TLM_PILOT | BIN_TLM_MUTE;
+  return(state->binaryTlmMask & fields ? state->binaryTlmPeriod : 0);
+}
+
+//
+// Check and execute a fully received frame
+//
+static int binaryDoFrame(Stream* stream, BinaryState* state)
+{
+  const uint8_t *frame = state->binaryFrame;
+  uint16_t length = state->binaryFrameLen;
+
+  // Empty frames are produced by back-to-back END characters
+  if(!length) return(0);
+
+  // Reply to truncated or overlong frames if they carry an id
+  if(state->binaryOverflow || length < BIN_OVERHEAD)
+  {
+    if(length >= 2)
+      binarySendError(stream, binaryGet16(frame), BIN_ERR_LENGTH, "Bad frame length");
+    return(0);
+  }
+
+  if(crc16(frame, length - 2) != binaryGet16(frame + length - 2))
+  {
+    binarySendError(stream, binaryGet16(frame), BIN_ERR_CRC, "Bad checksum");
+    return(0);
+  }
+
+  return(binaryDoRequest(stream, state, binaryGet16(frame), frame[2], frame + 3, length - BIN_OVERHEAD));
+}
+
+//
+// Receive available binary frames without blocking. Partial frames
+// are accumulated across calls, at most one request is executed
+// per call.
+//
+int binaryReceive(Stream* stream, BinaryState* state)
+{
+  while(stream->available())
+  {
+    uint8_t ch = stream->read();
+
+    if(ch == SLIP_END)
+    {
+      bool empty = !state->binaryFrameLen;
+      int event = binaryDoFrame(stream, state);
+      state->binaryFrameLen = 0;
+      state->binaryOverflow = false;
+      state->binaryEscape = false;
+      if(empty) continue;
+      return(event);
+    }
+
+    if(state->binaryEscape)
+    {
+      state->binaryEscape = false;
+      ch = ch == SLIP_ESC_END ? SLIP_END : ch == SLIP_ESC_ESC ? SLIP_ESC : ch;
+    }
+    else if(ch == SLIP_ESC)
+    {
+      state->binaryEscape = true;
+      continue;
+    }
+
+    if(state->binaryFrameLen >= BIN_FRAME_SIZE)
+      state->binaryOverflow = true;
+    else
+      state->binaryFrame[state->binaryFrameLen++] = ch;
+  }
+
+  return(0);
+}
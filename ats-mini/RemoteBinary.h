@@ -0,0 +1,70 @@
+#ifndef REMOTE_BINARY_H
+#define REMOTE_BINARY_H
+
+//
+// Binary remote protocol
+//
+// Each message is a SLIP (RFC 1055) frame containing:
+//   [id u16][opcode u8][payload ...][crc16 u16]
+// All multi-byte values are little-endian, CRC-16/CCITT-FALSE
+// covers id, opcode, and payload. Replies carry the request id
+// and the request opcode with BIN_REPLY bit set, or BIN_ERROR.
+//
+
+#define BIN_FRAME_SIZE    1600 // Maximum decoded frame size, fits all memories
+
+// Request opcodes
+#define BIN_PING          0x01 // -> u16 firmware version
+#define BIN_GET_STATUS    0x02 // -> status record, see binaryGetStatus()
+#define BIN_KEY           0x03 // u8 ad hoc command key -> u16 remote event
+#define BIN_SET_FREQ      0x04 // u32 frequency (Hz) ->
+#define BIN_GET_MEMORY    0x05 // u8 slot -> u8 slot, u32 freq, u8 band, u8 mode
+#define BIN_SET_MEMORY    0x06 // u8 slot, u32 freq, u8 band, u8 mode ->
+#define BIN_SUBSCRIBE     0x07 // u8 rate (Hz, 0 stops), u16 field mask ->
+#define BIN_MEM_EXPORT    0x08 // -> u8 count, count memory records
+#define BIN_MEM_IMPORT    0x09 // u8 count, count memory records -> u8 changed count
+#define BIN_SCRIPT_PUT    0x0A // name, 0, script text ->
+#define BIN_SCRIPT_RUN    0x0B // name (empty stops the running script) ->
+
+// Unsolicited telemetry record, id is the record sequence number
+#define BIN_TELEMETRY     0x40 // u16 field mask, selected fields
+
+// Reply opcodes
+#define BIN_REPLY         0x80 // Set in the request opcode on success
+#define BIN_ERROR         0xFF // u8 error code, error message text
+
+// Error codes
+#define BIN_ERR_CRC       1    // Frame checksum mismatch
+#define BIN_ERR_OPCODE    2    // Unknown opcode
+#define BIN_ERR_LENGTH    3    // Wrong payload length
+#define BIN_ERR_ARGUMENT  4    // Invalid argument value
+
+// Telemetry fields, sent in this order
+#define BIN_TLM_TIME      0x0001 // u32 record time (ms since boot)
+#define BIN_TLM_FREQ      0x0002 // u16 frequency (kHz, 10kHz in FM)
+#define BIN_TLM_BFO       0x0004 // i16 BFO (Hz)
+#define BIN_TLM_RSSI      0x0008 // u8 RSSI (dBuV)
+#define BIN_TLM_SNR       0x0010 // u8 SNR (dB)
+#define BIN_TLM_PILOT     0x0020 // u8 FM stereo pilot (0 or 1)
+#define BIN_TLM_MUTE      0x0040 // u8 mute state (bit 0 muted, bit 1 squelched)
+#define BIN_TLM_ALL       0x007F
+#define BIN_TLM_MAX_RATE  50     // Maximum telemetry rate (Hz)
+
+typedef struct {
+  bool binaryEscape = false;       // Previous byte was SLIP escape
+  bool binaryOverflow = false;     // Frame is too long, skipping it
+  uint16_t binaryFrameLen = 0;     // Bytes received so far
+  uint8_t binaryFrame[BIN_FRAME_SIZE];
+
+  // Telemetry subscription
+  uint16_t binaryTlmMask = 0;      // Selected fields, 0 if not subscribed
+  uint16_t binaryTlmPeriod = 0;    // Time between records (ms)
+  uint16_t binaryTlmSeqnum = 0;    // Record sequence number
+  uint32_t binaryTlmTime = 0;      // Time the last record was sent
+} BinaryState;
+
+void binaryTickTime(Stream* stream, BinaryState* state);
+int binaryReceive(Stream* stream, BinaryState* state);
+uint16_t binarySamplePeriod(const BinaryState* state);
+
+#endif
@@ -0,0 +1,221 @@
+#include "Common.h"
+#include "Storage.h"
+#include "Remote.h"
+#include "RemoteUdp.h"
+#include <WiFi.h>
+#include <WiFiUdp.h>
+
+#define UDP_MAX_CLIENTS       4  // Remote clients served at the same time
+#define UDP_CLIENT_TIMEOUT 60000 // Forget clients silent for this long (ms)
+#define UDP_PACKET_SIZE    1400  // Maximum datagram size
+#define UDP_RX_SIZE         512  // Received commands waiting to be executed
+#define UDP_TX_SIZE        1024  // Output collected into one datagram
+
+//
+// Stream over the datagrams of one client, output is collected
+// and sent back in datagrams of up to UDP_TX_SIZE bytes
+//
+class UdpRemoteStream : public Stream
+{
+  public:
+    void begin(WiFiUDP *socket, IPAddress ip, uint16_t port)
+    {
+      udp = socket;
+      txIP = ip;
+      txPort = port;
+      rxLen = rxPos = txLen = 0;
+    }
+
+    // Queue received commands, return false if they do not fit
+    bool receive(const uint8_t *data, size_t size)
+    {
+      if(rxPos)
+      {
+        memmove(rxBuf, rxBuf + rxPos, rxLen - rxPos);
+        rxLen -= rxPos;
+        rxPos = 0;
+      }
+      if(size > sizeof(rxBuf) - rxLen) return(false);
+
+      memcpy(rxBuf + rxLen, data, size);
+      rxLen += size;
+      return(true);
+    }
+
+    int available() override { return(rxLen - rxPos); }
+    int read() override { return(rxPos < rxLen ? rxBuf[rxPos++] : -1); }
+    int peek() override { return(rxPos < rxLen ? rxBuf[rxPos] : -1); }
+
+    // Datagrams are never blocked, output is only limited by the
+    // room left in the current one
+    int availableForWrite() override { return(sizeof(txBuf) - txLen); }
+
+    size_t write(uint8_t ch) override
+    {
+      if(txLen >= sizeof(txBuf)) flush();
+      txBuf[txLen++] = ch;
+      return(1);
+    }
+
+    size_t write(const uint8_t *data, size_t size) override
+    {
+      for(size_t i=0 ; i<size ; i++) write(data[i]);
+      return(size);
+    }
+
+    // Send accumulated output, if any
+    void flush() override
+    {
+      if(!txLen || !udp) return;
+      udp->beginPacket(txIP, txPort);
+      udp->write(txBuf, txLen);
+      udp->endPacket();
+      txLen = 0;
+    }
+
+    // Send an empty datagram (reply to a bare key)
+    void pong()
+    {
+      flush();
+      udp->beginPacket(txIP, txPort);
+      udp->endPacket();
+    }
+
+    bool is(IPAddress ip, uint16_t port) { return((txPort == port) && (txIP == ip)); }
+
+  private:
+    WiFiUDP *udp = NULL;
+    IPAddress txIP;
+    uint16_t txPort = 0;
+    uint8_t txBuf[UDP_TX_SIZE];
+    uint16_t txLen = 0;
+    uint8_t rxBuf[UDP_RX_SIZE];
+    uint16_t rxLen = 0;
+    uint16_t rxPos = 0;
+};
+
+typedef struct
+{
+  bool active = false;             // False if the slot is free
+  uint32_t lastSeen;               // Time the last datagram was received
+  UdpRemoteStream stream;          // Client address and buffers
+  RemoteState state;               // Ad hoc protocol session
+} UdpClient;
+
+static WiFiUDP udp;
+static UdpClient udpClients[UDP_MAX_CLIENTS];
+static char udpKey[UDP_KEY_SIZE] = "";
+static bool udpStarted = false;
+
+static void udpDropClient(UdpClient *client)
+{
+  if(!client->active) return;
+  remoteClose(&client->state);
+  client->active = false;
+}
+
+//
+// Find client by its address, or take the free or the least
+// recently seen slot for it
+//
+static UdpClient *udpGetClient(IPAddress ip, uint16_t port)
+{
+  UdpClient *oldest = &udpClients[0];
+
+  for(int j=0 ; j<UDP_MAX_CLIENTS ; j++)
+  {
+    UdpClient *client = &udpClients[j];
+    if(client->active && client->stream.is(ip, port)) return(client);
+    if(!client->active) oldest = client;
+    else if(oldest->active && ((int32_t)(client->lastSeen - oldest->lastSeen) < 0)) oldest = client;
+  }
+
+  // Each client gets its own session, executed by remoteLoop()
+  udpDropClient(oldest);
+  oldest->active = true;
+  oldest->stream.begin(&udp, ip, port);
+  remoteOpen(&oldest->stream, &oldest->state);
+  return(oldest);
+}
+
+//
+// Receive a datagram, check its key, and queue its commands
+// to the sender session
+//
+static bool udpReceive()
+{
+  static uint8_t packet[UDP_PACKET_SIZE];
+  int size = udp.parsePacket();
+
+  if(size <= 0) return(false);
+  size = udp.read(packet, sizeof(packet));
+
+  // Datagram starts with the shared key and a newline
+  size_t keyLen = strlen(udpKey);
+  if((size <= (int)keyLen) || memcmp(packet, udpKey, keyLen) || (packet[keyLen] != '\n'))
+    return(true);
+
+  UdpClient *client = udpGetClient(udp.remoteIP(), udp.remotePort());
+  client->lastSeen = millis();
+
+  // Key alone is a keep alive, answer it so clients can measure latency.
+  // Commands that do not fit are dropped, like the datagram itself could be.
+  if(size == (int)keyLen + 1)
+    client->stream.pong();
+  else
+    client->stream.receive(packet + keyLen + 1, size - keyLen - 1);
+
+  return(true);
+}
+
+//
+// Set shared key, empty key disables the UDP remote control
+//
+void udpSetKey(const char *key)
+{
+  snprintf(udpKey, sizeof(udpKey), "%s", key);
+
+  // Make existing clients authenticate again
+  for(int j=0 ; j<UDP_MAX_CLIENTS ; j++) udpDropClient(&udpClients[j]);
+}
+
+void udpInit()
+{
+  udpStop();
+
+  prefs.begin("network", true, STORAGE_PARTITION);
+  udpSetKey(prefs.getString("remotekey", "").c_str());
+  prefs.end();
+
+  udpStarted = !!udp.begin(UDP_REMOTE_PORT);
+}
+
+void udpStop()
+{
+  if(udpStarted) udp.stop();
+  udpStarted = false;
+  udpSetKey("");
+}
+
+//
+// Serve UDP remote clients: send output produced by remoteLoop()
+// since the previous call, expire silent clients, and take
+// waiting datagrams
+//
+void udpLoop()
+{
+  if(!udpStarted || !udpKey[0]) return;
+
+  for(int j=0 ; j<UDP_MAX_CLIENTS ; j++)
+  {
+    UdpClient *client = &udpClients[j];
+    if(!client->active) continue;
+
+    client->stream.flush();
+    if((millis() - client->lastSeen) > UDP_CLIENT_TIMEOUT)
+      udpDropClient(client);
+  }
+
+  // Bounded, so that a flood of datagrams can not stall the loop
+  for(int j=0 ; (j<UDP_MAX_CLIENTS) && udpReceive() ; j++);
+}
@@ -0,0 +1,12 @@
+#ifndef REMOTE_UDP_H
+#define REMOTE_UDP_H
+
+#define UDP_REMOTE_PORT  8700  // UDP port for the remote control
+#define UDP_KEY_SIZE       33  // Maximum shared key length + 1
+
+void udpInit();
+void udpStop();
+void udpSetKey(const char *key);
+void udpLoop();
+
+#endif
@@ -0,0 +1,168 @@
+#include "Common.h"
+#include "Remote.h"
+#include "RemoteWs.h"
+#include "WebWriter.h"
+#include "TaskQueue.h"
+
+#define WS_REMOTE_CLIENTS     2  // Browser consoles served at the same time
+#define WS_REMOTE_RX_SIZE   256  // Received commands waiting for the main loop
+#define WS_REMOTE_TX_SIZE  1024  // Output collected into one message
+
+static AsyncWebSocket wsRemote(WS_REMOTE_PATH);
+
+//
+// Stream over the messages of one WebSocket client. Input is
+// queued by the web server task and read by the main loop, output
+// is collected by the main loop and sent in binary messages.
+//
+class WsRemoteStream : public Stream
+{
+  public:
+    // Set by the web server task, the main loop opens or closes the
+    // session when it sees the change
+    uint32_t id = 0;
+    volatile bool connected = false;
+
+    // Queue received input, called by the web server task,
+    // input that does not fit is dropped
+    void receive(const uint8_t *data, size_t size) { rx.push(data, size); }
+
+    // Drop input and output, called by the main loop once disconnected
+    void reset()
+    {
+      rx.clear();
+      txLen = 0;
+    }
+
+    int available() override { return(rx.available()); }
+    int peek() override { return(rx.empty() ? -1 : *rx.front()); }
+
+    int read() override
+    {
+      uint8_t ch;
+      return(rx.pop(&ch) ? ch : -1);
+    }
+
+    // No room while the client has too many messages queued
+    int availableForWrite() override
+    {
+      return(wsRemote.availableForWrite(id) ? sizeof(txBuf) - txLen : 0);
+    }
+
+    size_t write(uint8_t ch) override
+    {
+      if(txLen >= sizeof(txBuf)) flush();
+      txBuf[txLen++] = ch;
+      return(1);
+    }
+
+    size_t write(const uint8_t *data, size_t size) override
+    {
+      for(size_t i=0 ; i<size ; i++) write(data[i]);
+      return(size);
+    }
+
+    // Send accumulated output, if any
+    void flush() override
+    {
+      if(!txLen) return;
+      wsRemote.binary(id, txBuf, txLen);
+      txLen = 0;
+    }
+
+  private:
+    TaskQueue<uint8_t, WS_REMOTE_RX_SIZE> rx;
+    uint8_t txBuf[WS_REMOTE_TX_SIZE];
+    uint16_t txLen = 0;
+};
+
+typedef struct
+{
+  volatile bool open = false;      // Session opened by the main loop
+  WsRemoteStream stream;
+  RemoteState state;               // Ad hoc protocol session
+} WsRemoteClient;
+
+static WsRemoteClient wsRemoteClients[WS_REMOTE_CLIENTS];
+
+//
+// Runs in the web server task: only moves data between the
+// clients and their streams, commands are executed by remoteLoop()
+//
+static void wsRemoteEvent(AsyncWebSocket *ws, AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data, size_t len)
+{
+  for(int j=0 ; j<WS_REMOTE_CLIENTS ; j++)
+  {
+    WsRemoteClient *c = &wsRemoteClients[j];
+
+    switch(type)
+    {
+      case WS_EVT_CONNECT:
+        // Slot is free once the main loop has closed its session
+        if(c->stream.connected || c->open) continue;
+        c->stream.id = client->id();
+        __sync_synchronize();
+        c->stream.connected = true;
+        return;
+
+      case WS_EVT_DISCONNECT:
+      case WS_EVT_DATA:
+        if(!c->stream.connected || (c->stream.id != client->id())) continue;
+        if(type == WS_EVT_DISCONNECT)
+          c->stream.connected = false;
+        else
+          c->stream.receive(data, len);
+        return;
+
+      default:
+        return;
+    }
+  }
+
+  if(type == WS_EVT_CONNECT) client->close(1013, "Too many consoles");
+}
+
+void wsRemoteInit(AsyncWebServer *server)
+{
+  // Commands change settings, so clients log in like the config
+  // page, others are refused before they take a slot
+  wsRemote.handleHandshake([] (AsyncWebServerRequest *request) {
+    return(webAuthenticate(request));
+  });
+  wsRemote.onEvent(wsRemoteEvent);
+  server->addHandler(&wsRemote);
+}
+
+void wsRemoteStop()
+{
+  // Sessions are closed by wsRemoteLoop() as clients disconnect
+  wsRemote.closeAll();
+}
+
+//
+// Open and close sessions of connected consoles, and send output
+// produced by remoteLoop() since the previous call
+//
+void wsRemoteLoop()
+{
+  for(int j=0 ; j<WS_REMOTE_CLIENTS ; j++)
+  {
+    WsRemoteClient *c = &wsRemoteClients[j];
+
+    if(c->stream.connected && !c->open)
+    {
+      remoteOpen(&c->stream, &c->state);
+      c->open = true;
+    }
+    else if(!c->stream.connected && c->open)
+    {
+      remoteClose(&c->state);
+      c->stream.reset();
+      c->open = false;
+    }
+    else if(c->open)
+    {
+      c->stream.flush();
+    }
+  }
+}
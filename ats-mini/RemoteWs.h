@@ -0,0 +1,12 @@
+#ifndef REMOTE_WS_H
+#define REMOTE_WS_H
+
+#include <ESPAsyncWebServer.h>
+
+#define WS_REMOTE_PATH  "/ws/remote" // WebSocket path of the remote console
+
+void wsRemoteInit(AsyncWebServer *server);
+void wsRemoteStop();
+void wsRemoteLoop();
+
+#endif
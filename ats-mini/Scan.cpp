@@ -8,6 +8,7 @@
 #define TUNE_DELAY_AM_SSB  80
 
 #define SCAN_POLL_TIME    10 // Tuning status polling interval (msecs)
+#define SCAN_TUNE_TIME   500 // Maximum time to wait for tuning (msecs)
 #define SCAN_POINTS      200 // Number of frequencies to scan
 
 #define SCAN_OFF    0   // Scanner off, no data
@@ -155,3 +156,44 @@ void scanRun(uint16_t centerFreq, uint16_t step)
   // Restore tuning delay
   rx.setMaxDelaySetFrequency(TUNE_DELAY_DEFAULT);
 }
+
+//
+// Scan count frequencies starting at startFreq, handing each point
+// to point() as soon as it is measured, nothing is stored. Stops
+// early when point() returns false or the scan is aborted.
+//
+void scanStream(uint16_t startFreq, uint16_t step, uint16_t count, bool (*point)(uint16_t freq, uint8_t rssi, uint8_t snr))
+{
+  // Set tuning delay
+  rx.setMaxDelaySetFrequency(currentMode == FM ? TUNE_DELAY_FM : TUNE_DELAY_AM_SSB);
+  // Mute the audio
+  muteOn(MUTE_TEMP, true);
+  // Flag is set by rotary encoder and cleared on seek/scan entry
+  seekStop = false;
+  // Save current frequency
+  uint16_t curFreq = rx.getFrequency();
+
+  for(uint16_t j=0 ; j<count ; j++)
+  {
+    uint16_t freq = startFreq + step * j;
+    rx.setFrequency(freq); // Implies tuning delay
+
+    // Poll for the tuning status
+    for(uint32_t t=millis() ; millis()-t < SCAN_TUNE_TIME ; delay(SCAN_POLL_TIME))
+    {
+      rx.getStatus(0, 0);
+      if(rx.getTuneCompleteTriggered()) break;
+    }
+
+    // Measure RSSI/SNR values
+    rx.getCurrentReceivedSignalQuality();
+    if(!point(freq, rx.getCurrentRSSI(), rx.getCurrentSNR()) || consumeAbortPending()) break;
+  }
+
+  // Restore current frequency
+  rx.setFrequency(curFreq);
+  // Unmute the audio
+  muteOn(MUTE_TEMP, false);
+  // Restore tuning delay
+  rx.setMaxDelaySetFrequency(TUNE_DELAY_DEFAULT);
+}
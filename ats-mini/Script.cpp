@@ -0,0 +1,243 @@
+#include "Common.h"
+#include "Utils.h"
+#include "Menu.h"
+#include "Remote.h"
+#include "Telemetry.h"
+#include "Script.h"
+#include "ScriptEngine.h"
+
+#include <LittleFS.h>
+#include <FS.h>
+
+#define SCRIPT_DIR       "/scripts"
+#define SCRIPT_LOG_SIZE  65536     // Log is restarted once it gets this big
+#define SCRIPT_OLD_PATH  "/script.old"
+
+static ScriptProgram scriptProgram;
+static ScriptVM scriptVM;
+static char scriptName[SCRIPT_NAME_SIZE] = "";
+static char scriptError[64];
+static Memory scriptOrigin;        // Where the script started, for restore
+static bool scriptChanged = false; // Radio state changed by the last step
+
+//
+// Radio access for the script engine
+//
+
+static const char *scriptBand(const char *name)
+{
+  for(int i=0 ; i<getTotalBands() ; i++)
+  {
+    if(strcasecmp(bands[i].bandName, name)) continue;
+
+    if(i != bandIdx)
+    {
+      // Save current band settings
+      bands[bandIdx].currentFreq = currentFrequency + currentBFO / 1000;
+      bands[bandIdx].bandMode = currentMode;
+      bandIdx = i;
+      selectBand(bandIdx);
+      scriptChanged = true;
+    }
+    return(NULL);
+  }
+
+  return("No such band");
+}
+
+static const char *scriptMode(const char *name)
+{
+  for(int i=0 ; i<getTotalModes() ; i++)
+  {
+    if(strcasecmp(bandModeDesc[i], name)) continue;
+    if(i == currentMode) return(NULL);
+
+    // FM is only available in FM bands, and only FM there
+    if((i == FM) || (currentMode == FM)) return("Mode is not available in this band");
+
+    selectMode(i);
+    scriptChanged = true;
+    return(NULL);
+  }
+
+  return("No such mode");
+}
+
+static const char *scriptTune(uint32_t freqHz)
+{
+  scriptChanged = true;
+  return(remoteTuneFrequency(freqHz));
+}
+
+static void scriptMeasure(uint8_t *rssi, uint8_t *snr)
+{
+  // Fresh reading, the frequency may have just changed
+  telemetrySampleSignal();
+  *rssi = telemetryGet()->rssi;
+  *snr  = telemetryGet()->snr;
+}
+
+static void scriptLogLine(const char *text)
+{
+  // Keep the previous log when starting a new one
+  if(LittleFS.exists(SCRIPT_LOG_PATH))
+  {
+    fs::File file = LittleFS.open(SCRIPT_LOG_PATH, "r");
+    size_t size = file ? file.size() : 0;
+    file.close();
+    if(size >= SCRIPT_LOG_SIZE)
+    {
+      LittleFS.remove(SCRIPT_OLD_PATH);
+      LittleFS.rename(SCRIPT_LOG_PATH, SCRIPT_OLD_PATH);
+    }
+  }
+
+  fs::File file = LittleFS.open(SCRIPT_LOG_PATH, "a");
+  if(!file) return;
+  file.printf("%lu,%s,%s,%s\n", millis() / 1000, clockAvailable() ? clockGet() : "", scriptName, text);
+  file.close();
+}
+
+static void scriptLog(const char *text, uint8_t rssi, uint8_t snr)
+{
+  char line[128];
+  snprintf(line, sizeof(line), "%lu,%s,%u,%u,%s",
+    (unsigned long)(freqToHz(currentFrequency, currentMode) + currentBFO),
+    bandModeDesc[currentMode], rssi, snr, text);
+  scriptLogLine(line);
+}
+
+static void scriptRestore()
+{
+  scriptChanged |= tuneToMemory(&scriptOrigin);
+}
+
+static uint32_t scriptMillis()
+{
+  return(millis());
+}
+
+static const ScriptHooks scriptHooks =
+{
+  scriptBand, scriptMode, scriptTune, scriptMeasure,
+  scriptLog, scriptRestore, scriptMillis
+};
+
+//
+// Script names become file names, keep them simple
+//
+static bool scriptValidName(const char *name)
+{
+  size_t len = strlen(name);
+  if(!len || len >= SCRIPT_NAME_SIZE) return(false);
+
+  for(; *name ; name++)
+    if(!isalnum((unsigned char)*name) && (*name != '_') && (*name != '-'))
+      return(false);
+
+  return(true);
+}
+
+static const char *scriptCompileError()
+{
+  snprintf(scriptError, sizeof(scriptError), "Line %u: %s", scriptVM.errorLine, scriptVM.error);
+  return(scriptError);
+}
+
+const char *scriptSave(const char *name, const char *text, size_t size)
+{
+  if(!scriptValidName(name)) return("Invalid script name");
+  if(size > SCRIPT_FILE_SIZE) return("Script is too long");
+
+  // Check the new script without touching the running one
+  ScriptProgram *program = (ScriptProgram *)malloc(sizeof(ScriptProgram));
+  ScriptVM vm;
+  if(!program) return("Out of memory");
+  bool compiled = scriptCompile(program, &vm, text, size);
+  free(program);
+  if(!compiled)
+  {
+    snprintf(scriptError, sizeof(scriptError), "Line %u: %s", vm.errorLine, vm.error);
+    return(scriptError);
+  }
+
+  char path[sizeof(SCRIPT_DIR) + SCRIPT_NAME_SIZE + 1];
+  snprintf(path, sizeof(path), SCRIPT_DIR "/%s", name);
+
+  LittleFS.mkdir(SCRIPT_DIR);
+  fs::File file = LittleFS.open(path, "w");
+  if(!file) return("Cannot create script file");
+  bool written = file.write((const uint8_t *)text, size) == size;
+  file.close();
+
+  return(written ? NULL : "Cannot write script file");
+}
+
+const char *scriptRun(const char *name)
+{
+  scriptStop();
+  if(!scriptValidName(name)) return("Invalid script name");
+
+  char path[sizeof(SCRIPT_DIR) + SCRIPT_NAME_SIZE + 1];
+  snprintf(path, sizeof(path), SCRIPT_DIR "/%s", name);
+
+  fs::File file = LittleFS.open(path, "r");
+  if(!file) return("No such script");
+  if(file.size() > SCRIPT_FILE_SIZE)
+  {
+    file.close();
+    return("Script is too long");
+  }
+
+  char *text = (char *)malloc(SCRIPT_FILE_SIZE);
+  size_t size = text ? file.read((uint8_t *)text, SCRIPT_FILE_SIZE) : 0;
+  file.close();
+  if(!text) return("Out of memory");
+
+  bool compiled = scriptCompile(&scriptProgram, &scriptVM, text, size);
+  free(text);
+  if(!compiled) return(scriptCompileError());
+
+  // Remember where to return to
+  scriptOrigin.freq = freqToHz(currentFrequency, currentMode) + currentBFO;
+  scriptOrigin.band = bandIdx;
+  scriptOrigin.mode = currentMode;
+
+  snprintf(scriptName, sizeof(scriptName), "%s", name);
+  scriptStart(&scriptVM);
+  scriptLogLine("started");
+  return(NULL);
+}
+
+void scriptStop()
+{
+  if(scriptVM.status != SCRIPT_RUNNING) return;
+  scriptVM.status = SCRIPT_DONE;
+  scriptLogLine("stopped");
+}
+
+const char *scriptRunning()
+{
+  return(scriptVM.status == SCRIPT_RUNNING ? scriptName : NULL);
+}
+
+bool scriptTickTime()
+{
+  if(scriptVM.status != SCRIPT_RUNNING) return(false);
+
+  // Scripts do not fight the user for the receiver
+  if(sleepOn() || currentCmd == CMD_SEEK || currentCmd == CMD_SCAN) return(false);
+
+  scriptChanged = false;
+  switch(scriptStep(&scriptVM, &scriptProgram, &scriptHooks))
+  {
+    case SCRIPT_DONE:
+      scriptLogLine("done");
+      break;
+    case SCRIPT_ERROR:
+      scriptLogLine(scriptCompileError());
+      break;
+  }
+
+  return(scriptChanged);
+}
@@ -0,0 +1,20 @@
+#ifndef SCRIPT_H
+#define SCRIPT_H
+
+#define SCRIPT_NAME_SIZE    17     // Maximum script name length + 1
+#define SCRIPT_FILE_SIZE  1536     // Maximum script file size, fits a binary frame
+#define SCRIPT_LOG_PATH   "/script.log"
+
+// Store script text in LittleFS after checking that it compiles,
+// these return an error message or NULL on success
+const char *scriptSave(const char *name, const char *text, size_t size);
+const char *scriptRun(const char *name);
+void scriptStop();
+
+// Name of the running script, NULL if none
+const char *scriptRunning();
+
+// Step the running script, return true if the radio state has changed
+bool scriptTickTime();
+
+#endif // SCRIPT_H
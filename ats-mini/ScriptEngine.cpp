@@ -0,0 +1,353 @@
+#include "ScriptEngine.h"
+#include <string.h>
+#include <stdlib.h>
+#include <ctype.h>
+#include <strings.h>
+
+// Opcodes
+#define OP_BAND     1  // arg: band name
+#define OP_MODE     2  // arg: mode name
+#define OP_TUNE     3  // arg: frequency (Hz)
+#define OP_WAIT     4  // arg: time (ms)
+#define OP_MEASURE  5
+#define OP_LOG      6  // arg: text
+#define OP_RESTORE  7
+#define OP_STOP     8
+#define OP_REPEAT   9  // arg: count, 0 if forever
+#define OP_LOOP    10  // jump: first instruction of the repeat block
+#define OP_IF      11  // var, cmp, arg: condition, jump: else or end
+#define OP_JUMP    12  // jump: target
+
+// Compared readings
+#define VAR_RSSI    0
+#define VAR_SNR     1
+
+// Comparisons
+#define CMP_LT      0
+#define CMP_LE      1
+#define CMP_GT      2
+#define CMP_GE      3
+#define CMP_EQ      4
+#define CMP_NE      5
+
+static const char *cmpNames[] = { "<", "<=", ">", ">=", "==", "!=" };
+
+//
+// Split the next word off the line, return NULL at the end of line
+//
+static char *scriptWord(char **p)
+{
+  while(**p && isspace((unsigned char)**p)) (*p)++;
+  if(!**p) return(NULL);
+
+  char *word = *p;
+  while(**p && !isspace((unsigned char)**p)) (*p)++;
+  if(**p) *(*p)++ = '\0';
+  return(word);
+}
+
+//
+// Parse an unsigned decimal number, with an optional time unit
+// when scale is true
+//
+static bool scriptNumber(const char *word, uint32_t *result, bool scale = false)
+{
+  char *end;
+
+  if(!word || !isdigit((unsigned char)*word)) return(false);
+  unsigned long value = strtoul(word, &end, 10);
+  uint32_t unit = 1;
+
+  if(scale && !strcasecmp(end, "s"))      { unit = 1000; end += 1; }
+  else if(scale && !strcasecmp(end, "m")) { unit = 60000; end += 1; }
+  else if(scale && !strcasecmp(end, "ms")) end += 2;
+
+  // Values that do not fit into 32 bits are an error
+  if(value > UINT32_MAX / unit) return(false);
+
+  *result = value * unit;
+  return(!*end);
+}
+
+//
+// Store text argument in the program pool
+//
+static bool scriptText(ScriptProgram *program, const char *text, uint32_t *offset)
+{
+  size_t size = strlen(text) + 1;
+  if(program->poolSize + size > SCRIPT_POOL_SIZE) return(false);
+
+  memcpy(program->pool + program->poolSize, text, size);
+  *offset = program->poolSize;
+  program->poolSize += size;
+  return(true);
+}
+
+static bool scriptFail(ScriptVM *vm, uint16_t line, const char *message)
+{
+  vm->status    = SCRIPT_ERROR;
+  vm->errorLine = line;
+  vm->error     = message;
+  return(false);
+}
+
+//
+// Compile one line into the program, blocks holds the indices of
+// the open repeat, if, and else instructions
+//
+static bool scriptCompileLine(ScriptProgram *program, ScriptVM *vm, char *p, uint16_t line, uint16_t *blocks, uint8_t *depth)
+{
+  char *hash = strchr(p, '#');
+  if(hash) *hash = '\0';
+
+  char *cmd = scriptWord(&p);
+  if(!cmd) return(true);
+
+  if(program->size >= SCRIPT_MAX_CODE)
+    return(scriptFail(vm, line, "Script is too long"));
+
+  ScriptInstr *instr = &program->code[program->size];
+  memset(instr, 0, sizeof(*instr));
+  instr->line = line;
+
+  // Optional rest of the line, with surrounding whitespace removed
+  while(*p && isspace((unsigned char)*p)) p++;
+  for(char *end = p + strlen(p) ; (end > p) && isspace((unsigned char)end[-1]) ; ) *--end = '\0';
+
+  if(!strcasecmp(cmd, "band") || !strcasecmp(cmd, "mode"))
+  {
+    instr->op = tolower((unsigned char)*cmd) == 'b' ? OP_BAND : OP_MODE;
+    if(!*p || strpbrk(p, " \t")) return(scriptFail(vm, line, "Expected a name"));
+    if(!scriptText(program, p, &instr->arg)) return(scriptFail(vm, line, "Script is too long"));
+  }
+  else if(!strcasecmp(cmd, "tune"))
+  {
+    instr->op = OP_TUNE;
+    if(!scriptNumber(p, &instr->arg) || !instr->arg) return(scriptFail(vm, line, "Invalid frequency"));
+  }
+  else if(!strcasecmp(cmd, "wait"))
+  {
+    instr->op = OP_WAIT;
+    if(!scriptNumber(p, &instr->arg, true)) return(scriptFail(vm, line, "Invalid time"));
+  }
+  else if(!strcasecmp(cmd, "log"))
+  {
+    instr->op = OP_LOG;
+    if(!scriptText(program, p, &instr->arg)) return(scriptFail(vm, line, "Script is too long"));
+  }
+  else if(!strcasecmp(cmd, "measure") || !strcasecmp(cmd, "restore") || !strcasecmp(cmd, "stop"))
+  {
+    instr->op = !strcasecmp(cmd, "measure") ? OP_MEASURE : !strcasecmp(cmd, "restore") ? OP_RESTORE : OP_STOP;
+    if(*p) return(scriptFail(vm, line, "Unexpected argument"));
+  }
+  else if(!strcasecmp(cmd, "repeat") || !strcasecmp(cmd, "if"))
+  {
+    if(*depth >= SCRIPT_MAX_DEPTH) return(scriptFail(vm, line, "Blocks are nested too deep"));
+
+    if(tolower((unsigned char)*cmd) == 'r')
+    {
+      instr->op = OP_REPEAT;
+      if(*p && (!scriptNumber(p, &instr->arg) || !instr->arg)) return(scriptFail(vm, line, "Invalid count"));
+    }
+    else
+    {
+      char *var = scriptWord(&p);
+      char *cmp = scriptWord(&p);
+      char *value = scriptWord(&p);
+      int j;
+
+      instr->op = OP_IF;
+      if(!var || (strcasecmp(var, "rssi") && strcasecmp(var, "snr")))
+        return(scriptFail(vm, line, "Expected rssi or snr"));
+      instr->var = strcasecmp(var, "rssi") ? VAR_SNR : VAR_RSSI;
+
+      for(j=0 ; cmp && (j<(int)(sizeof(cmpNames)/sizeof(cmpNames[0]))) && strcmp(cmp, cmpNames[j]) ; j++);
+      if(!cmp || (j >= (int)(sizeof(cmpNames)/sizeof(cmpNames[0]))))
+        return(scriptFail(vm, line, "Invalid comparison"));
+      instr->cmp = j;
+
+      if(!scriptNumber(value, &instr->arg) || scriptWord(&p))
+        return(scriptFail(vm, line, "Invalid value"));
+    }
+
+    blocks[(*depth)++] = program->size;
+  }
+  else if(!strcasecmp(cmd, "else"))
+  {
+    if(!*depth || (program->code[blocks[*depth - 1]].op != OP_IF))
+      return(scriptFail(vm, line, "Else without if"));
+    if(*p) return(scriptFail(vm, line, "Unexpected argument"));
+
+    // Skip the else part at the end of the if part
+    instr->op = OP_JUMP;
+    program->code[blocks[*depth - 1]].jump = program->size + 1;
+    blocks[*depth - 1] = program->size;
+  }
+  else if(!strcasecmp(cmd, "end"))
+  {
+    if(!*depth) return(scriptFail(vm, line, "End without block"));
+    if(*p) return(scriptFail(vm, line, "Unexpected argument"));
+
+    uint16_t start = blocks[--(*depth)];
+    if(program->code[start].op == OP_REPEAT)
+    {
+      instr->op   = OP_LOOP;
+      instr->jump = start + 1;
+    }
+    else
+    {
+      // Nothing to execute, if and else jump past the block
+      program->code[start].jump = program->size;
+      return(true);
+    }
+  }
+  else
+  {
+    return(scriptFail(vm, line, "Unknown command"));
+  }
+
+  program->size++;
+  return(true);
+}
+
+bool scriptCompile(ScriptProgram *program, ScriptVM *vm, const char *text, size_t size)
+{
+  uint16_t blocks[SCRIPT_MAX_DEPTH];
+  uint8_t depth = 0;
+  uint16_t line = 0;
+  char buf[128];
+
+  *vm = ScriptVM();
+  program->size = 0;
+  program->poolSize = 0;
+
+  for(size_t pos=0 ; pos<size ; )
+  {
+    // Copy next line, lines that do not fit are an error
+    size_t len = 0;
+    line++;
+    while((pos < size) && (text[pos] != '\n'))
+    {
+      if(len >= sizeof(buf) - 1) return(scriptFail(vm, line, "Line is too long"));
+      buf[len++] = text[pos++];
+    }
+    buf[len] = '\0';
+    pos++;
+
+    if(!scriptCompileLine(program, vm, buf, line, blocks, &depth)) return(false);
+  }
+
+  if(depth)
+    return(scriptFail(vm, program->code[blocks[depth - 1]].line, "Block without end"));
+
+  return(true);
+}
+
+void scriptStart(ScriptVM *vm)
+{
+  vm->status   = SCRIPT_RUNNING;
+  vm->pc       = 0;
+  vm->depth    = 0;
+  vm->waitTime = 0;
+  vm->error    = NULL;
+}
+
+static bool scriptCompare(const ScriptVM *vm, const ScriptInstr *instr)
+{
+  uint32_t value = instr->var == VAR_SNR ? vm->snr : vm->rssi;
+
+  switch(instr->cmp)
+  {
+    case CMP_LT: return(value <  instr->arg);
+    case CMP_LE: return(value <= instr->arg);
+    case CMP_GT: return(value >  instr->arg);
+    case CMP_GE: return(value >= instr->arg);
+    case CMP_EQ: return(value == instr->arg);
+    case CMP_NE: return(value != instr->arg);
+  }
+  return(false);
+}
+
+uint8_t scriptStep(ScriptVM *vm, const ScriptProgram *program, const ScriptHooks *hooks)
+{
+  if(vm->status != SCRIPT_RUNNING) return(vm->status);
+
+  // Current wait
+  if(vm->waitTime)
+  {
+    if((hooks->millis() - vm->waitStart) < vm->waitTime) return(SCRIPT_RUNNING);
+    vm->waitTime = 0;
+  }
+
+  for(int count=0 ; count<SCRIPT_STEP_COUNT ; count++)
+  {
+    if(vm->pc >= program->size)
+    {
+      vm->status = SCRIPT_DONE;
+      return(vm->status);
+    }
+
+    const ScriptInstr *instr = &program->code[vm->pc++];
+    const char *error = NULL;
+
+    switch(instr->op)
+    {
+      case OP_BAND:
+        error = hooks->band(program->pool + instr->arg);
+        break;
+      case OP_MODE:
+        error = hooks->mode(program->pool + instr->arg);
+        break;
+      case OP_TUNE:
+        error = hooks->tune(instr->arg);
+        break;
+      case OP_MEASURE:
+        hooks->measure(&vm->rssi, &vm->snr);
+        break;
+      case OP_LOG:
+        hooks->log(program->pool + instr->arg, vm->rssi, vm->snr);
+        break;
+      case OP_RESTORE:
+        hooks->restore();
+        break;
+
+      case OP_WAIT:
+        if(!instr->arg) continue;
+        vm->waitStart = hooks->millis();
+        vm->waitTime  = instr->arg;
+        return(SCRIPT_RUNNING);
+
+      case OP_STOP:
+        vm->status = SCRIPT_DONE;
+        return(vm->status);
+
+      case OP_REPEAT:
+        vm->loops[vm->depth++] = instr->arg;
+        continue;
+      case OP_LOOP:
+        // Forever loops keep zero count
+        if(!vm->loops[vm->depth - 1] || --vm->loops[vm->depth - 1])
+          vm->pc = instr->jump;
+        else
+          vm->depth--;
+        continue;
+      case OP_IF:
+        if(!scriptCompare(vm, instr)) vm->pc = instr->jump;
+        continue;
+      case OP_JUMP:
+        vm->pc = instr->jump;
+        continue;
+    }
+
+    if(error)
+    {
+      scriptFail(vm, instr->line, error);
+      return(vm->status);
+    }
+
+    // One radio action per step, the rest of the firmware runs in between
+    return(SCRIPT_RUNNING);
+  }
+
+  return(SCRIPT_RUNNING);
+}
@@ -0,0 +1,96 @@
+#ifndef SCRIPT_ENGINE_H
+#define SCRIPT_ENGINE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+//
+// Script engine: compiles line scripts into a compact bytecode
+// and executes it in small steps. Radio access goes through the
+// ScriptHooks, so the engine does not depend on the firmware and
+// can be built on a host.
+//
+// Script syntax, one command per line, '#' starts a comment:
+//   band <name>            Select band
+//   mode <FM|LSB|USB|AM>   Select mode
+//   tune <Hz>              Tune within the current band
+//   wait <n>[ms|s|m]       Wait, milliseconds by default
+//   measure                Take RSSI and SNR reading
+//   log [text]             Log frequency, RSSI, SNR, and text
+//   restore                Return to the band, mode, and frequency
+//                          the script started with
+//   stop                   End the script
+//   repeat [n] ... end     Repeat n times, forever if n is missing
+//   if <rssi|snr> <op> <n> ... [else ...] end
+//                          Compare the last reading, op is one of
+//                          < <= > >= == !=
+//
+
+#define SCRIPT_MAX_CODE   128  // Maximum number of instructions
+#define SCRIPT_POOL_SIZE  512  // Maximum size of all text arguments
+#define SCRIPT_MAX_DEPTH    8  // Maximum block nesting
+#define SCRIPT_STEP_COUNT  16  // Maximum instructions per step
+
+// Step results
+#define SCRIPT_IDLE       0    // Nothing loaded
+#define SCRIPT_RUNNING    1
+#define SCRIPT_DONE       2
+#define SCRIPT_ERROR      3
+
+typedef struct
+{
+  uint8_t op;              // Opcode
+  uint8_t var;             // Compared reading, IF only
+  uint8_t cmp;             // Comparison, IF only
+  uint16_t line;           // Source line, for error messages
+  uint16_t jump;           // Jump target
+  uint32_t arg;            // Number or text pool offset
+} ScriptInstr;
+
+typedef struct
+{
+  uint16_t size;           // Number of instructions
+  uint16_t poolSize;       // Bytes used in the text pool
+  ScriptInstr code[SCRIPT_MAX_CODE];
+  char pool[SCRIPT_POOL_SIZE];
+} ScriptProgram;
+
+typedef struct
+{
+  uint8_t status = SCRIPT_IDLE;
+  uint16_t pc = 0;                 // Next instruction
+  uint8_t depth = 0;               // Active repeat blocks
+  uint32_t loops[SCRIPT_MAX_DEPTH];// Iterations left, 0 if forever
+  uint32_t waitStart = 0;          // Time the current wait began
+  uint32_t waitTime = 0;           // Wait duration, 0 if not waiting
+  uint8_t rssi = 0;                // Last reading
+  uint8_t snr = 0;
+  uint16_t errorLine = 0;          // Line of the failed command
+  const char *error = NULL;        // Compile or runtime error
+} ScriptVM;
+
+//
+// Radio access, functions return an error message or NULL
+//
+typedef struct
+{
+  const char *(*band)(const char *name);
+  const char *(*mode)(const char *name);
+  const char *(*tune)(uint32_t freqHz);
+  void (*measure)(uint8_t *rssi, uint8_t *snr);
+  void (*log)(const char *text, uint8_t rssi, uint8_t snr);
+  void (*restore)();
+  uint32_t (*millis)();
+} ScriptHooks;
+
+// Compile script text, on failure vm->error and vm->errorLine are set
+bool scriptCompile(ScriptProgram *program, ScriptVM *vm, const char *text, size_t size);
+
+// Start executing compiled program from the beginning
+void scriptStart(ScriptVM *vm);
+
+// Execute a few instructions, stopping after a radio action or
+// at a wait, return SCRIPT_RUNNING until the script ends
+uint8_t scriptStep(ScriptVM *vm, const ScriptProgram *program, const ScriptHooks *hooks);
+
+#endif
@@ -22,6 +22,9 @@ void prefsRequestSave(uint32_t what, bool now)
   // Underflow is ok here, see prefsTickTime()
   storeTime = millis() - (now? STORE_TIME : 0);
   itIsTimeToSave |= what;
+
+  // Web pages show settings and memories
+  if(what & (SAVE_SETTINGS|SAVE_BANDS|SAVE_MEMORIES)) webStateChanged();
 }
 
 void prefsTickTime()
@@ -0,0 +1,90 @@
+#ifndef TASK_QUEUE_H
+#define TASK_QUEUE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+//
+// Lock-free queue handing items from one task to another, e.g.
+// from the web server or BLE task to the main loop. There must be
+// exactly one producer task, calling push() and room(), and one
+// consumer task, calling everything else. N is a power of two,
+// one slot is always left empty, so N-1 items fit.
+//
+template<typename T, uint16_t N>
+class TaskQueue
+{
+  static_assert(N >= 2 && !(N & (N - 1)), "TaskQueue size must be a power of two");
+
+  public:
+    //
+    // Producer side
+    //
+
+    // Queue one item, false if the queue is full
+    bool push(const T &item)
+    {
+      uint16_t next = (head + 1) & (N - 1);
+      if(next == tail) return(false);
+
+      items[head] = item;
+      // Item must be stored before the consumer can see it
+      __sync_synchronize();
+      head = next;
+      return(true);
+    }
+
+    // Queue as many items as fit, returns the number queued
+    size_t push(const T *data, size_t count)
+    {
+      size_t j;
+      for(j=0 ; j<count && push(data[j]) ; j++);
+      return(j);
+    }
+
+    // Free slots, the consumer can only add to them
+    uint16_t room() const { return((tail - head - 1) & (N - 1)); }
+
+    //
+    // Consumer side
+    //
+
+    // Queued items, the producer can only add to them
+    uint16_t available() const { return((head - tail) & (N - 1)); }
+    bool empty() const { return(head == tail); }
+
+    // Oldest item, NULL if the queue is empty
+    const T *front() const
+    {
+      if(head == tail) return(NULL);
+      __sync_synchronize();
+      return(&items[tail]);
+    }
+
+    // Remove the oldest item, copying it to *item if not NULL
+    bool pop(T *item = NULL)
+    {
+      const T *first = front();
+      if(!first) return(false);
+
+      if(item) *item = *first;
+      // Item must be read before the producer can reuse its slot
+      __sync_synchronize();
+      tail = (tail + 1) & (N - 1);
+      return(true);
+    }
+
+    // Drop all queued items
+    void clear()
+    {
+      __sync_synchronize();
+      tail = head;
+    }
+
+  private:
+    T items[N];
+    volatile uint16_t head = 0;  // Written by the producer
+    volatile uint16_t tail = 0;  // Written by the consumer
+};
+
+#endif
@@ -0,0 +1,66 @@
+#include "Common.h"
+#include "Telemetry.h"
+
+#define TELEMETRY_TIME        500  // Antenna capacitor refresh period (ms)
+#define TELEMETRY_ANTCAP_HOLD 5000  // Keep refreshing it after the last request (ms)
+
+static Telemetry telemetry = { 0 };
+
+static uint32_t antCapTime = 0;              // Time of the last reading
+static volatile uint32_t antCapWantTime = 0; // Time of the last request
+static volatile bool antCapWanted = false;
+
+const Telemetry *telemetryGet()
+{
+  return(&telemetry);
+}
+
+//
+// Sample signal quality, called by the main loop as often as the
+// squelch, the display, and remote subscribers need it
+//
+void telemetrySampleSignal()
+{
+  rx.getCurrentReceivedSignalQuality();
+  telemetry.rssi  = rx.getCurrentRSSI();
+  telemetry.snr   = rx.getCurrentSNR();
+  telemetry.pilot = rx.getCurrentPilot();
+  telemetry.signalTime = millis();
+}
+
+//
+// Antenna capacitor takes an I2C transfer to read and is not shown
+// on the screen, so it is only read while somebody reports it
+//
+void telemetryReadAntCap()
+{
+  if(antCapTime && ((millis() - antCapTime) < TELEMETRY_TIME)) return;
+  antCapTime = millis();
+
+  // Use rx.getFrequency to force read of capacitor value from SI4732/5
+  rx.getFrequency();
+  telemetry.antCap = rx.getAntennaTuningCapacitor();
+}
+
+void telemetryWantAntCap()
+{
+  antCapWantTime = millis();
+  antCapWanted = true;
+}
+
+bool telemetryTickTime()
+{
+  // Battery has its own measurement schedule
+  bool changed = batteryTickTime();
+  telemetry.voltage = batteryVoltage();
+
+  if(antCapWanted)
+  {
+    if((millis() - antCapWantTime) > TELEMETRY_ANTCAP_HOLD)
+      antCapWanted = false;
+    else
+      telemetryReadAntCap();
+  }
+
+  return(changed);
+}
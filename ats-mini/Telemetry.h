@@ -0,0 +1,38 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include "Common.h"
+
+//
+// Last hardware readings shared by the display and all remote
+// front-ends, so that extra clients add no extra hardware polling
+//
+typedef struct
+{
+  uint32_t signalTime;      // Time of the last signal quality sample (ms)
+  uint8_t rssi;             // Last RSSI sample (dBuV)
+  uint8_t snr;              // Last SNR sample (dB)
+  bool pilot;               // Last FM stereo pilot sample
+  uint16_t antCap;          // Antenna tuning capacitor
+  float voltage;            // Battery voltage (V)
+} Telemetry;
+
+// Get current snapshot
+const Telemetry *telemetryGet();
+
+// Read signal quality from the receiver into the snapshot
+void telemetrySampleSignal();
+
+// Read the antenna capacitor into the snapshot unless the last
+// reading is recent, for status reports made by the main loop
+void telemetryReadAntCap();
+
+// Keep the antenna capacitor reading fresh for a few seconds,
+// for status reports made outside the main loop
+void telemetryWantAntCap();
+
+// Periodically refresh the rest of the snapshot, return true if
+// the displayed battery status has changed and needs redrawing
+bool telemetryTickTime();
+
+#endif // TELEMETRY_H
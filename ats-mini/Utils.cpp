@@ -18,8 +18,29 @@ static bool sleep_on = false;
 static bool ssbLoaded = false;
 
 // Time
-static bool clockHasBeenSet = false;
-static uint32_t clockTimer  = 0;
+#define CLOCK_MAGIC      0x434C4B31  // Marks valid data in clockRtc
+#define CLOCK_CORRECT_TIME       60  // Drift correction period (s)
+#define CLOCK_DRIFT_TIME       3600  // Shortest time to measure drift over (s)
+#define CLOCK_DRIFT_MAX        2000  // Largest believable drift (ppm)
+
+//
+// The clock runs on the system time, which keeps counting over
+// light sleep and software resets. NTP updates measure how fast
+// the system time runs, clockTickTime() corrects it accordingly.
+// Kept over software resets, along with the system time.
+//
+typedef struct
+{
+  uint32_t magic;          // CLOCK_MAGIC
+  bool set;                // System time has been set
+  float drift;             // System time runs fast by this much (ppm)
+  int64_t lastSeen;        // Last system time seen, detects system time reset (us)
+  int64_t correctTime;     // Last drift correction time (us)
+  int64_t driftStart;      // Drift measurement start time, 0 if none (us)
+  int64_t driftError;      // Error found by NTP since driftStart (us)
+} ClockRtc;
+
+static RTC_NOINIT_ATTR ClockRtc clockRtc;
 static uint8_t clockSeconds = 0;
 static uint8_t clockMinutes = 0;
 static uint8_t clockHours   = 0;
@@ -267,9 +288,60 @@ bool sleepOn(int x)
 // Set and count time
 //
 
+static int64_t clockSystemTime()
+{
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return((int64_t)tv.tv_sec * 1000000 + tv.tv_usec);
+}
+
+static void clockSystemSet(int64_t time)
+{
+  struct timeval tv = { (time_t)(time / 1000000), (suseconds_t)(time % 1000000) };
+  settimeofday(&tv, NULL);
+}
+
+// Take time of day from the system time, TRUE if the minute changed
+static bool clockShow(int64_t time)
+{
+  uint32_t t = (time / 1000000) % (24 * 60 * 60);
+  uint8_t hours = t / 3600, minutes = t / 60 % 60;
+
+  clockSeconds = t % 60;
+  if((clockText[0]) && (hours==clockHours) && (minutes==clockMinutes))
+    return(false);
+
+  clockHours   = hours;
+  clockMinutes = minutes;
+  clockRefreshTime();
+  return(true);
+}
+
+//
+// Restore the clock after a software reset
+//
+void clockInit()
+{
+  int64_t now = clockSystemTime();
+
+  if(clockRtc.magic!=CLOCK_MAGIC)
+  {
+    memset(&clockRtc, 0, sizeof(clockRtc));
+    clockRtc.magic = CLOCK_MAGIC;
+  }
+  else if(now<clockRtc.lastSeen)
+  {
+    // System time did not survive the reset, the drift did
+    clockRtc.set = false;
+    clockRtc.driftStart = 0;
+  }
+
+  if(clockRtc.set) clockShow(now);
+}
+
 bool clockAvailable()
 {
-  return(clockHasBeenSet);
+  return(clockRtc.set);
 }
 
 const char *clockGet()
@@ -277,12 +349,12 @@ const char *clockGet()
   if(switchThemeEditor())
     return("00:00");
   else
-    return(clockHasBeenSet? clockText : NULL);
+    return(clockRtc.set? clockText : NULL);
 }
 
 bool clockGetHM(uint8_t *hours, uint8_t *minutes)
 {
-  if(!clockHasBeenSet) return(false);
+  if(!clockRtc.set) return(false);
   else
   {
     *hours   = clockHours;
@@ -293,9 +365,9 @@ bool clockGetHM(uint8_t *hours, uint8_t *minutes)
 
 void clockReset()
 {
-  clockHasBeenSet = false;
+  clockRtc.set = false;
+  clockRtc.driftStart = 0;
   clockText[0] = '\0';
-  clockTimer = 0;
   clockHours = clockMinutes = clockSeconds = 0;
 }
 
@@ -308,20 +380,26 @@ static void formatClock(uint8_t hours, uint8_t minutes)
 
 void clockRefreshTime()
 {
-  if(clockHasBeenSet) formatClock(clockHours, clockMinutes);
+  if(clockRtc.set) formatClock(clockHours, clockMinutes);
 }
 
 bool clockSet(uint8_t hours, uint8_t minutes, uint8_t seconds)
 {
   // Verify input before setting clock
-  if(!clockHasBeenSet && hours < 24 && minutes < 60 && seconds < 60)
+  if(!clockRtc.set && hours < 24 && minutes < 60 && seconds < 60)
   {
-    clockHasBeenSet = true;
-    clockTimer   = micros();
-    clockHours   = hours;
-    clockMinutes = minutes;
-    clockSeconds = seconds;
-    clockRefreshTime();
+    // Keep the system date, set the time of day
+    int64_t day = clockSystemTime() / 1000000 / (24 * 60 * 60);
+    int64_t now = ((day * 24 + hours) * 60 + minutes) * 60 + seconds;
+    now *= 1000000;
+    clockSystemSet(now);
+
+    // Not accurate enough to measure drift
+    clockRtc.set = true;
+    clockRtc.lastSeen = clockRtc.correctTime = now;
+    clockRtc.driftStart = 0;
+
+    clockShow(now);
     identifyFrequency(currentFrequency + currentBFO / 1000);
     return(true);
   }
@@ -330,38 +408,69 @@ bool clockSet(uint8_t hours, uint8_t minutes, uint8_t seconds)
   return(false);
 }
 
-bool clockTickTime()
+//
+// Set system time to the given NTP time (us), measuring drift
+//
+bool clockSync(int64_t time)
 {
-  // Need to set the clock first, then accumulate one second of time
-  if(clockHasBeenSet && (micros() - clockTimer >= 1000000))
-  {
-    uint32_t delta;
+  int64_t now = time;
+  int64_t error = clockSystemTime() - time;
+
+  clockSystemSet(now);
 
-    delta = (micros() - clockTimer) / 1000000;
-    clockTimer += delta * 1000000;
-    clockSeconds += delta;
+  // Part of the error is drift clockTickTime() did not correct yet
+  error -= (now - clockRtc.correctTime) * (double)clockRtc.drift / 1000000;
 
-    if(clockSeconds>=60)
+  // NTP is only accurate to some milliseconds, so sum errors
+  // over an hour or more before adjusting the drift
+  if(clockRtc.set && clockRtc.driftStart)
+  {
+    clockRtc.driftError += error;
+    if((now - clockRtc.driftStart) >= (int64_t)CLOCK_DRIFT_TIME * 1000000)
     {
-      delta = clockSeconds / 60;
-      clockSeconds -= delta * 60;
-      clockMinutes += delta;
+      clockRtc.drift += clockRtc.driftError * 1000000.0 / (now - clockRtc.driftStart);
+      clockRtc.drift = min(max(clockRtc.drift, (float)-CLOCK_DRIFT_MAX), (float)CLOCK_DRIFT_MAX);
+      clockRtc.driftStart = now;
+      clockRtc.driftError = 0;
+    }
+  }
+  else
+  {
+    clockRtc.driftStart = now;
+    clockRtc.driftError = 0;
+  }
 
-      if(clockMinutes>=60)
-      {
-        delta = clockMinutes / 60;
-        clockMinutes -= delta * 60;
-        clockHours = (clockHours + delta) % 24;
-      }
+  clockRtc.set = true;
+  clockRtc.lastSeen = clockRtc.correctTime = now;
+
+  clockShow(now);
+  identifyFrequency(currentFrequency + currentBFO / 1000);
+  return(true);
+}
 
-      // Format clock for display and ask for screen update
-      clockRefreshTime();
-      return(true);
+bool clockTickTime()
+{
+  // Need to set the clock first
+  if(!clockRtc.set) return(false);
+
+  int64_t now = clockSystemTime();
+
+  // Take measured drift out of the system time
+  if((now - clockRtc.correctTime) >= (int64_t)CLOCK_CORRECT_TIME * 1000000)
+  {
+    int64_t fix = (now - clockRtc.correctTime) * (double)clockRtc.drift / 1000000;
+    if(fix)
+    {
+      now -= fix;
+      clockSystemSet(now);
     }
+    clockRtc.correctTime = now;
   }
 
-  // No screen update
-  return(false);
+  clockRtc.lastSeen = now;
+
+  // Ask for screen update when the minute changes
+  return(clockShow(now));
 }
 
 //
@@ -456,3 +565,57 @@ int getStrength(int rssi)
     return                 17; //>S9 +60
   }
 }
+
+//
+// Run-length encode 16bit pixels. Each packet starts with a header
+// byte: 0x00-0x7F is followed by 1-128 literal pixels, 0x80-0xFF is
+// followed by a single pixel repeated 2-129 times. Pixels are copied
+// as they are stored in memory. Returns the encoded size in bytes.
+//
+size_t rleEncode(const uint16_t *pixels, size_t count, uint8_t *out)
+{
+  size_t size = 0;
+
+  for(size_t i=0 ; i<count ; )
+  {
+    size_t n = 1;
+
+    // Count repeated pixels
+    while((i+n < count) && (n < 129) && (pixels[i+n] == pixels[i])) n++;
+
+    if(n >= 2)
+    {
+      out[size++] = 0x80 | (n - 2);
+      memcpy(out + size, pixels + i, sizeof(uint16_t));
+      size += sizeof(uint16_t);
+    }
+    else
+    {
+      // Count literal pixels, stopping before the next repeat
+      while((i+n < count) && (n < 128) && !((i+n+1 < count) && (pixels[i+n] == pixels[i+n+1]))) n++;
+
+      out[size++] = n - 1;
+      memcpy(out + size, pixels + i, n * sizeof(uint16_t));
+      size += n * sizeof(uint16_t);
+    }
+
+    i += n;
+  }
+
+  return(size);
+}
+
+//
+// Compute CRC-16/CCITT-FALSE (polynomial 0x1021) checksum
+//
+uint16_t crc16(const uint8_t *data, size_t size, uint16_t crc)
+{
+  while(size--)
+  {
+    crc ^= (uint16_t)(*data++) << 8;
+    for(int i=0 ; i<8 ; i++)
+      crc = crc & 0x8000? (crc << 1) ^ 0x1021 : crc << 1;
+  }
+
+  return(crc);
+}
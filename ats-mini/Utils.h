@@ -26,10 +26,12 @@ bool sleepOn(int x = 2);
 bool muteOn(uint8_t mode, int x = 2);
 
 // Wall clock functions
+void clockInit();
 const char *clockGet();
 bool clockAvailable();
 bool clockGetHM(uint8_t *hours, uint8_t *minutes);
 bool clockSet(uint8_t hours, uint8_t minutes, uint8_t seconds = 0);
+bool clockSync(int64_t time);
 void clockReset();
 bool clockTickTime();
 void clockRefreshTime();
@@ -45,4 +47,11 @@ uint32_t freqToHz(uint16_t freq, uint8_t mode);
 // Check if given frequency belongs to a band
 bool isFreqInBand(const Band *band, uint16_t freq);
 
+// Run-length encode 16bit pixels, output buffer must hold RLE_MAX_SIZE() bytes
+#define RLE_MAX_SIZE(pixels) ((pixels) * 2 + (pixels) / 128 + 2)
+size_t rleEncode(const uint16_t *pixels, size_t count, uint8_t *out);
+
+// Compute CRC-16/CCITT-FALSE checksum
+uint16_t crc16(const uint8_t *data, size_t size, uint16_t crc = 0xFFFF);
+
 #endif // UTILS_H
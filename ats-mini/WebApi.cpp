@@ -0,0 +1,859 @@
+#include "Common.h"
+#include "Menu.h"
+#include "Utils.h"
+#include "Remote.h"
+#include "Telemetry.h"
+#include "Json.h"
+#include "WebWriter.h"
+#include "WebApi.h"
+#include "TaskQueue.h"
+
+#define API_BODY_SIZE   256  // Maximum request body size
+#define API_MAX_FIELDS    8  // Maximum number of fields in a request
+#define API_MAX_BANDS    40  // Maximum number of bands listed
+#define API_QUEUE_SIZE    4  // Changes waiting for the main loop (power of two)
+#define API_SCAN_POINTS 1000  // Maximum number of points in a scan
+#define API_SCAN_DEFAULT 200  // Number of points scanned by default
+#define API_SCAN_QUEUE   64  // Scan points waiting to be sent (power of two)
+
+// Changes handed to the main loop
+#define API_SET_RADIO     1
+#define API_SET_MEMORY    2
+#define API_SET_BAND      3
+#define API_SCAN          4
+
+// Fields present in a radio or band change
+#define API_FREQ      0x0001
+#define API_BAND      0x0002
+#define API_MODE      0x0004
+#define API_VOLUME    0x0008
+#define API_AGC       0x0010
+#define API_STEP      0x0020
+#define API_BANDWIDTH 0x0040
+#define API_USBCAL    0x0080
+#define API_LSBCAL    0x0100
+
+typedef struct
+{
+  uint8_t type;            // API_SET_*
+  uint8_t index;           // Memory slot or band index
+  uint16_t fields;         // API_FREQ ... API_LSBCAL
+  uint32_t freq;           // Frequency (Hz)
+  uint8_t band;
+  uint8_t mode;
+  uint8_t volume;
+  uint8_t agc;
+  uint8_t step;            // Step index
+  uint8_t bandwidth;       // Bandwidth index
+  int16_t usbCal;
+  int16_t lsbCal;
+  Memory memory;
+  uint16_t scanFreq;       // First scanned frequency (band units)
+  uint16_t scanStep;       // Scan step (band units)
+  uint16_t scanCount;      // Number of scanned frequencies
+} ApiChange;
+
+//
+// Handlers run in the web server task and only validate requests.
+// Changes are queued for the main loop, which applies them between
+// its other work in webApiLoop().
+//
+static TaskQueue<ApiChange, API_QUEUE_SIZE> apiChanges;
+
+// Memory slots with queued changes, only used by the web server task
+// and cleared once the main loop has applied every queued change
+static bool apiPendingSlots[MEMORY_COUNT];
+
+// Body of the request being received
+static char apiBody[API_BODY_SIZE];
+static size_t apiBodyLen = 0;
+static AsyncWebServerRequest *apiBodyOwner = NULL;
+
+// Data shown by the GET requests, copied when a request arrives
+typedef struct
+{
+  uint32_t uptime;
+  uint32_t freq;
+  uint8_t band;
+  uint8_t mode;
+  const char *step;
+  const char *bandwidth;
+  int8_t agc;
+  uint8_t volume;
+  Telemetry tlm;
+} ApiStatusInfo;
+
+typedef struct
+{
+  uint8_t first;           // First slot (0-based)
+  uint8_t count;           // Number of slots, 1 if a single slot
+  Memory memories[MEMORY_COUNT];
+} ApiMemoryInfo;
+
+typedef struct
+{
+  uint8_t first;           // First band index
+  uint8_t count;           // Number of bands, 1 if a single band
+  Band bands[API_MAX_BANDS];
+} ApiBandInfo;
+
+typedef struct
+{
+  const char *error;       // Error message, NULL if queued
+  int slot;                // Created memory slot, 0 if none
+} ApiReply;
+
+static const char *apiBandTypes[] = { "FM", "MW", "SW", "LW" };
+
+//
+// Replies
+//
+
+static void apiRenderReply(WebWriter &out, const ApiReply &reply)
+{
+  if(reply.error)
+  {
+    out.print("{\"error\":");
+    out.printJson(reply.error);
+    out.print("}");
+  }
+  else if(reply.slot)
+    out.printf("{\"status\":\"queued\",\"slot\":%d}", reply.slot);
+  else
+    out.print("{\"status\":\"queued\"}");
+}
+
+static void apiReply(AsyncWebServerRequest *request, int code, const char *error, int slot = 0)
+{
+  ApiReply reply = { error, slot };
+  webSendPage(request, "application/json", apiRenderReply, reply, code);
+}
+
+static bool apiSubmit(AsyncWebServerRequest *request, const ApiChange *change, int slot = 0)
+{
+  // Earlier changes have not been applied yet
+  if(!apiChanges.push(*change))
+  {
+    apiReply(request, 503, "Busy");
+    return(false);
+  }
+
+  apiReply(request, 202, NULL, slot);
+  return(true);
+}
+
+//
+// Request parsing
+//
+
+static void apiReceiveBody(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total)
+{
+  // Bodies that do not fit are left for the handler to reject
+  if(!index)
+  {
+    apiBodyOwner = total < sizeof(apiBody) ? request : NULL;
+    apiBodyLen = 0;
+  }
+
+  if(apiBodyOwner != request) return;
+  if((index != apiBodyLen) || (apiBodyLen + len >= sizeof(apiBody)))
+  {
+    apiBodyOwner = NULL;
+    return;
+  }
+
+  memcpy(apiBody + apiBodyLen, data, len);
+  apiBodyLen += len;
+}
+
+// Parse the request body, replying with an error on failure
+static int apiParseBody(AsyncWebServerRequest *request, JsonField *fields)
+{
+  int count = -1;
+
+  if(request->contentLength() >= sizeof(apiBody))
+  {
+    apiReply(request, 413, "Request is too large");
+    return(-1);
+  }
+
+  // Body must have been received for this very request
+  if((apiBodyOwner == request) && (apiBodyLen == request->contentLength()))
+  {
+    apiBody[apiBodyLen] = '\0';
+    count = jsonParse(apiBody, fields, API_MAX_FIELDS);
+  }
+
+  apiBodyOwner = NULL;
+  if(count < 0) apiReply(request, 400, "Expected a JSON object");
+  return(count);
+}
+
+//
+// Get index from the "<path>/<index>" URL, counting from first,
+// return -1 for "<path>" and -2 if the index is not valid
+//
+static int apiPathIndex(AsyncWebServerRequest *request, const char *path, int first, int count)
+{
+  const char *p = request->url().c_str() + strlen(path);
+  char *end;
+
+  if(!*p) return(-1);
+  if(*p++ != '/' || !isdigit((unsigned char)*p)) return(-2);
+
+  long index = strtol(p, &end, 10) - first;
+  return(*end || (index < 0) || (index >= count) ? -2 : index);
+}
+
+static int apiFindMode(const char *name)
+{
+  for(int i=0 ; i<getTotalModes() ; i++)
+    if(!strcasecmp(bandModeDesc[i], name)) return(i);
+
+  return(-1);
+}
+
+static int apiFindStep(uint8_t mode, const char *name)
+{
+  const Step *step;
+
+  for(int i=0 ; (step = getStep(mode, i)) ; i++)
+    if(!strcasecmp(step->desc, name)) return(i);
+
+  return(-1);
+}
+
+static int apiFindBandwidth(uint8_t mode, const char *name)
+{
+  const Bandwidth *bw;
+
+  for(int i=0 ; (bw = getBandwidth(mode, i)) ; i++)
+    if(!strcasecmp(bw->desc, name)) return(i);
+
+  return(-1);
+}
+
+static int apiMaxAgc(uint8_t mode)
+{
+  return(mode == FM ? 27 : mode == AM ? 37 : 1);
+}
+
+//
+// Status
+//
+
+static void apiRenderStatus(WebWriter &out, const ApiStatusInfo &info)
+{
+  out.printf("{\"version\":%d,\"uptime\":%u,", VER_APP, (unsigned int)info.uptime);
+  out.printf("\"frequency\":%u,\"band\":%d,", (unsigned int)info.freq, info.band);
+  out.printf("\"mode\":\"%s\",\"step\":", bandModeDesc[info.mode]);
+  out.printJson(info.step);
+  out.print(",\"bandwidth\":");
+  out.printJson(info.bandwidth);
+  out.printf(",\"agc\":%d,\"volume\":%d,", info.agc, info.volume);
+  out.printf("\"rssi\":%d,\"snr\":%d,\"stereo\":%s,", info.tlm.rssi, info.tlm.snr, info.tlm.pilot? "true":"false");
+  out.printf("\"antennaCap\":%d,\"battery\":%.2f}", info.tlm.antCap, info.tlm.voltage);
+}
+
+static void apiGetStatus(AsyncWebServerRequest *request)
+{
+  ApiStatusInfo info;
+
+  info.uptime    = millis() / 1000;
+  info.freq      = freqToHz(currentFrequency, currentMode) + currentBFO;
+  info.band      = bandIdx;
+  info.mode      = currentMode;
+  info.step      = getCurrentStep()->desc;
+  info.bandwidth = getCurrentBandwidth()->desc;
+  info.agc       = agcIdx;
+  info.volume    = volume;
+  info.tlm       = *telemetryGet();
+
+  // Runs in the web server task, the reading is taken by the main loop
+  telemetryWantAntCap();
+
+  webSendPage(request, "application/json", apiRenderStatus, info);
+}
+
+//
+// Radio: frequency, band, mode, volume, and AGC
+//
+
+static void apiRenderRadio(WebWriter &out, const ApiStatusInfo &info)
+{
+  out.printf(
+    "{\"frequency\":%u,\"band\":%d,\"mode\":\"%s\",\"volume\":%d,\"agc\":%d}",
+    (unsigned int)info.freq, info.band, bandModeDesc[info.mode], info.volume, info.agc
+  );
+}
+
+static void apiGetRadio(AsyncWebServerRequest *request)
+{
+  ApiStatusInfo info;
+
+  info.freq   = freqToHz(currentFrequency, currentMode) + currentBFO;
+  info.band   = bandIdx;
+  info.mode   = currentMode;
+  info.volume = volume;
+  info.agc    = agcIdx;
+
+  webSendPage(request, "application/json", apiRenderRadio, info);
+}
+
+static void apiPutRadio(AsyncWebServerRequest *request)
+{
+  static const char *const keys[] = { "frequency", "band", "mode", "volume", "agc", NULL };
+  JsonField fields[API_MAX_FIELDS];
+
+  if(!webAuthenticate(request)) return(request->requestAuthentication());
+
+  int count = apiParseBody(request, fields);
+  if(count < 0) return;
+
+  const JsonField *freq = jsonGet(fields, count, "frequency", JSON_NUMBER);
+  const JsonField *band = jsonGet(fields, count, "band", JSON_NUMBER);
+  const JsonField *mode = jsonGet(fields, count, "mode", JSON_STRING);
+  const JsonField *vol  = jsonGet(fields, count, "volume", JSON_NUMBER);
+  const JsonField *agc  = jsonGet(fields, count, "agc", JSON_NUMBER);
+
+  if(!jsonOnly(fields, count, keys) || (count != !!freq + !!band + !!mode + !!vol + !!agc))
+    return(apiReply(request, 400, "Expected frequency, band, mode, volume, or agc"));
+
+  ApiChange change = {};
+  change.type = API_SET_RADIO;
+
+  // Validate against the band and mode the radio will end up in
+  change.band = band ? band->num : bandIdx;
+  if(band && (band->num < 0 || band->num >= getTotalBands()))
+    return(apiReply(request, 400, "Invalid band"));
+  change.mode = band ? bands[change.band].bandMode : currentMode;
+
+  if(mode)
+  {
+    int idx = apiFindMode(mode->str);
+    if(idx < 0) return(apiReply(request, 400, "Invalid mode"));
+    if((idx == FM) != (change.mode == FM))
+      return(apiReply(request, 400, "Mode is not available in this band"));
+    change.mode = idx;
+  }
+
+  if(freq && (freq->num <= 0 || !isFreqInBand(&bands[change.band], freqFromHz(freq->num, change.mode))))
+    return(apiReply(request, 400, "Frequency is out of range for the band"));
+  if(vol && (vol->num < 0 || vol->num > 63))
+    return(apiReply(request, 400, "Invalid volume"));
+  if(agc && (agc->num < 0 || agc->num > apiMaxAgc(change.mode)))
+    return(apiReply(request, 400, "Invalid AGC"));
+
+  change.fields = (freq? API_FREQ:0) | (band? API_BAND:0) | (mode? API_MODE:0) | (vol? API_VOLUME:0) | (agc? API_AGC:0);
+  change.freq   = freq ? freq->num : 0;
+  change.volume = vol ? vol->num : 0;
+  change.agc    = agc ? agc->num : 0;
+  apiSubmit(request, &change);
+}
+
+static void apiApplyRadio(const ApiChange *change)
+{
+  if((change->fields & API_BAND) && (change->band != bandIdx))
+  {
+    // Save current band settings
+    bands[bandIdx].currentFreq = currentFrequency + currentBFO / 1000;
+    bands[bandIdx].bandMode = currentMode;
+    selectBand(change->band);
+  }
+
+  // FM is only available in FM bands, and only FM there
+  if((change->fields & API_MODE) && (change->mode != currentMode) && (change->mode != FM) && (currentMode != FM))
+    selectMode(change->mode);
+
+  if(change->fields & API_FREQ)   remoteTuneFrequency(change->freq);
+  if(change->fields & API_VOLUME) doVolume(change->volume - volume);
+
+  // Range depends on the mode, which may have been just changed
+  if((change->fields & API_AGC) && (change->agc <= apiMaxAgc(currentMode)))
+    doAgc(change->agc - (currentMode == FM ? FmAgcIdx : isSSB() ? SsbAgcIdx : AmAgcIdx));
+}
+
+//
+// Memories
+//
+
+static void apiRenderMemories(WebWriter &out, const ApiMemoryInfo &info)
+{
+  bool list = info.count > 1;
+  bool first = true;
+
+  if(list) out.print("[");
+
+  for(int j=info.first ; j<info.first+info.count ; j++)
+  {
+    const Memory *mem = &info.memories[j];
+    if(!mem->freq) continue;
+
+    out.printf(
+      "%s{\"slot\":%d,\"frequency\":%u,\"band\":%d,\"mode\":\"%s\",\"name\":",
+      first? "":",", j + 1, (unsigned int)mem->freq, mem->band, bandModeDesc[mem->mode]
+    );
+    out.printJson(mem->name);
+    out.print("}");
+    first = false;
+  }
+
+  if(list) out.print("]");
+}
+
+// Parse and validate a memory slot
+static const char *apiParseMemory(const JsonField *fields, int count, Memory *mem)
+{
+  static const char *const keys[] = { "frequency", "band", "mode", "name", NULL };
+  const JsonField *freq = jsonGet(fields, count, "frequency", JSON_NUMBER);
+  const JsonField *band = jsonGet(fields, count, "band", JSON_NUMBER);
+  const JsonField *mode = jsonGet(fields, count, "mode", JSON_STRING);
+  const JsonField *name = jsonGet(fields, count, "name", JSON_STRING);
+
+  if(!jsonOnly(fields, count, keys) || !freq || !band || !mode)
+    return("Expected frequency, band, mode, and optional name");
+  if(band->num < 0 || band->num >= getTotalBands())
+    return("Invalid band");
+  if(freq->num <= 0)
+    return("Invalid frequency");
+
+  int idx = apiFindMode(mode->str);
+  if(idx < 0) return("Invalid mode");
+
+  memset(mem, 0, sizeof(*mem));
+  mem->freq = freq->num;
+  mem->band = band->num;
+  mem->mode = idx;
+  if(name) strlcpy(mem->name, name->str, sizeof(mem->name));
+
+  if(!isMemoryInBand(&bands[mem->band], mem))
+    return("Frequency or mode is not valid for the band");
+
+  return(NULL);
+}
+
+static void apiMemories(AsyncWebServerRequest *request)
+{
+  // Anyone may read, changes need the web login
+  if((request->method() != HTTP_GET) && !webAuthenticate(request))
+    return(request->requestAuthentication());
+
+  int slot = apiPathIndex(request, "/api/memories", 1, getTotalMemories());
+  if(slot < -1) return(apiReply(request, 404, "No such memory slot"));
+
+  ApiChange change = {};
+  change.type = API_SET_MEMORY;
+  JsonField fields[API_MAX_FIELDS];
+  int count;
+
+  switch(request->method())
+  {
+    case HTTP_GET:
+    {
+      // Handlers run one at a time, keep this off the small task stack
+      static ApiMemoryInfo info;
+      info.first = slot < 0 ? 0 : slot;
+      info.count = slot < 0 ? getTotalMemories() : 1;
+      memcpy(info.memories, memories, sizeof(info.memories));
+
+      if(slot >= 0 && !info.memories[slot].freq)
+        return(apiReply(request, 404, "Memory slot is empty"));
+      webSendPage(request, "application/json", apiRenderMemories, info);
+      return;
+    }
+
+    case HTTP_POST:
+      // Main loop has caught up, no slot is pending anymore
+      if(apiChanges.room() == API_QUEUE_SIZE - 1)
+        memset(apiPendingSlots, 0, sizeof(apiPendingSlots));
+
+      // Store into the first empty slot without queued changes
+      for(slot=0 ; (slot < getTotalMemories()) && (memories[slot].freq || apiPendingSlots[slot]) ; slot++);
+      if(slot >= getTotalMemories())
+        return(apiReply(request, 409, "No empty memory slots"));
+      // fall through
+
+    case HTTP_PUT:
+    {
+      if(slot < 0) return(apiReply(request, 405, "Expected memory slot"));
+      if((count = apiParseBody(request, fields)) < 0) return;
+
+      const char *error = apiParseMemory(fields, count, &change.memory);
+      if(error) return(apiReply(request, 400, error));
+
+      change.index = slot;
+      if(apiSubmit(request, &change, request->method() == HTTP_POST ? slot + 1 : 0))
+        apiPendingSlots[slot] = true;
+      return;
+    }
+
+    case HTTP_DELETE:
+      if(slot < 0) return(apiReply(request, 405, "Expected memory slot"));
+      change.index = slot;
+      apiSubmit(request, &change);
+      return;
+  }
+}
+
+//
+// Bands
+//
+
+static void apiRenderBands(WebWriter &out, const ApiBandInfo &info)
+{
+  bool list = info.count > 1;
+
+  if(list) out.print("[");
+
+  for(int j=info.first ; j<info.first+info.count ; j++)
+  {
+    const Band *band = &info.bands[j];
+    const Step *step = getStep(band->bandMode, band->currentStepIdx);
+    const Bandwidth *bw = getBandwidth(band->bandMode, band->bandwidthIdx);
+
+    out.printf("%s{\"index\":%d,\"name\":", j > info.first ? ",":"", j);
+    out.printJson(band->bandName);
+    out.printf(
+      ",\"type\":\"%s\",\"minimum\":%u,\"maximum\":%u,\"frequency\":%u,\"mode\":\"%s\",",
+      apiBandTypes[band->bandType],
+      (unsigned int)freqToHz(band->minimumFreq, band->bandMode),
+      (unsigned int)freqToHz(band->maximumFreq, band->bandMode),
+      (unsigned int)freqToHz(band->currentFreq, band->bandMode),
+      bandModeDesc[band->bandMode]
+    );
+    out.print("\"step\":");
+    out.printJson(step ? step->desc : "");
+    out.print(",\"bandwidth\":");
+    out.printJson(bw ? bw->desc : "");
+    out.printf(",\"usbCal\":%d,\"lsbCal\":%d}", band->usbCal, band->lsbCal);
+  }
+
+  if(list) out.print("]");
+}
+
+static void apiBands(AsyncWebServerRequest *request)
+{
+  if((request->method() != HTTP_GET) && !webAuthenticate(request))
+    return(request->requestAuthentication());
+
+  int total = min(getTotalBands(), API_MAX_BANDS);
+  int idx = apiPathIndex(request, "/api/bands", 0, total);
+  if(idx < -1) return(apiReply(request, 404, "No such band"));
+
+  if(request->method() == HTTP_GET)
+  {
+    // Off the stack, like the memory list
+    static ApiBandInfo info;
+    info.first = idx < 0 ? 0 : idx;
+    info.count = idx < 0 ? total : 1;
+    memcpy(info.bands, bands, total * sizeof(Band));
+
+    // Current band settings live in the radio state
+    if(bandIdx < total)
+    {
+      info.bands[bandIdx].currentFreq = currentFrequency + currentBFO / 1000;
+      info.bands[bandIdx].bandMode = currentMode;
+    }
+
+    webSendPage(request, "application/json", apiRenderBands, info);
+    return;
+  }
+
+  static const char *const keys[] = { "frequency", "mode", "step", "bandwidth", "usbCal", "lsbCal", NULL };
+  JsonField fields[API_MAX_FIELDS];
+  int count;
+
+  if(idx < 0) return(apiReply(request, 405, "Expected band index"));
+  if((count = apiParseBody(request, fields)) < 0) return;
+
+  const JsonField *freq = jsonGet(fields, count, "frequency", JSON_NUMBER);
+  const JsonField *mode = jsonGet(fields, count, "mode", JSON_STRING);
+  const JsonField *step = jsonGet(fields, count, "step", JSON_STRING);
+  const JsonField *bw   = jsonGet(fields, count, "bandwidth", JSON_STRING);
+  const JsonField *usb  = jsonGet(fields, count, "usbCal", JSON_NUMBER);
+  const JsonField *lsb  = jsonGet(fields, count, "lsbCal", JSON_NUMBER);
+
+  if(!jsonOnly(fields, count, keys) || (count != !!freq + !!mode + !!step + !!bw + !!usb + !!lsb))
+    return(apiReply(request, 400, "Expected frequency, mode, step, bandwidth, usbCal, or lsbCal"));
+
+  const Band *band = &bands[idx];
+  ApiChange change = {};
+  change.type = API_SET_BAND;
+  change.index = idx;
+  change.mode  = idx == bandIdx ? currentMode : band->bandMode;
+
+  if(mode)
+  {
+    int m = apiFindMode(mode->str);
+    if(m < 0) return(apiReply(request, 400, "Invalid mode"));
+    if((m == FM) != (band->bandMode == FM))
+      return(apiReply(request, 400, "Mode is not available in this band"));
+    change.mode = m;
+  }
+
+  int stepIdx = step ? apiFindStep(change.mode, step->str) : 0;
+  int bwIdx = bw ? apiFindBandwidth(change.mode, bw->str) : 0;
+
+  if(freq && (freq->num <= 0 || !isFreqInBand(band, freqFromHz(freq->num, change.mode))))
+    return(apiReply(request, 400, "Frequency is out of range for the band"));
+  if(stepIdx < 0)
+    return(apiReply(request, 400, "Invalid step"));
+  if(bwIdx < 0)
+    return(apiReply(request, 400, "Invalid bandwidth"));
+  if((usb && abs(usb->num) > MAX_CAL) || (lsb && abs(lsb->num) > MAX_CAL))
+    return(apiReply(request, 400, "Invalid calibration"));
+
+  change.fields    = (freq? API_FREQ:0) | (mode? API_MODE:0) | (step? API_STEP:0) |
+                     (bw? API_BANDWIDTH:0) | (usb? API_USBCAL:0) | (lsb? API_LSBCAL:0);
+  change.freq      = freq ? freq->num : 0;
+  change.step      = stepIdx;
+  change.bandwidth = bwIdx;
+  change.usbCal    = usb ? usb->num : 0;
+  change.lsbCal    = lsb ? lsb->num : 0;
+  apiSubmit(request, &change);
+}
+
+static void apiApplyBand(const ApiChange *change)
+{
+  Band *band = &bands[change->index];
+  bool current = change->index == bandIdx;
+
+  // Current band settings live in the radio state
+  if(current)
+  {
+    band->currentFreq = currentFrequency + currentBFO / 1000;
+    band->bandMode = currentMode;
+  }
+
+  // Use default step and bandwidth when changing modes
+  if((change->fields & API_MODE) && (change->mode != band->bandMode))
+  {
+    band->bandMode = change->mode;
+    band->currentStepIdx = getDefaultStepIdx(change->mode);
+    band->bandwidthIdx = getDefaultBandwidthIdx(change->mode);
+  }
+
+  if(change->fields & API_FREQ)      band->currentFreq = freqFromHz(change->freq, band->bandMode);
+  if(change->fields & API_STEP)      band->currentStepIdx = change->step;
+  if(change->fields & API_BANDWIDTH) band->bandwidthIdx = change->bandwidth;
+  if(change->fields & API_USBCAL)    band->usbCal = change->usbCal;
+  if(change->fields & API_LSBCAL)    band->lsbCal = change->lsbCal;
+
+  // Reload the current band with new settings
+  if(current)
+  {
+    selectBand(bandIdx);
+    if(change->fields & API_FREQ) remoteTuneFrequency(change->freq);
+  }
+}
+
+//
+// Band scope: the main loop scans and queues every point as soon as
+// it is measured, the response streams queued points as NDJSON while
+// the scan is still running
+//
+
+typedef struct
+{
+  uint16_t freq;           // Frequency (band units)
+  uint8_t rssi;
+  uint8_t snr;
+} ApiScanPoint;
+
+static TaskQueue<ApiScanPoint, API_SCAN_QUEUE> apiScanPoints;
+static volatile bool apiScanBusy   = false;  // Cleared by the main loop when done
+static volatile bool apiScanCancel = false;  // Client has gone away
+static uint32_t apiScanId = 0;               // Current scan, older streams end
+
+typedef struct
+{
+  uint32_t id;             // Scan being streamed
+  uint32_t start;          // First frequency (Hz)
+  uint32_t step;           // Step (Hz)
+  uint16_t count;          // Number of points to scan
+  uint16_t sent;           // Number of points sent
+  uint8_t mode;
+  bool done;               // Final line has been sent
+} ApiScanStream;
+
+static size_t apiScanSend(ApiScanStream *stream, uint8_t *buf, size_t maxLen, size_t index)
+{
+  char line[80];
+  size_t len = 0;
+
+  // Stream of a previous scan, or the final line has been sent
+  if((stream->id != apiScanId) || stream->done) return(0);
+  if(maxLen < sizeof(line)) return(RESPONSE_TRY_AGAIN);
+
+  // Header goes first, then points as they are measured
+  if(!index)
+    len = sprintf((char *)buf, "{\"start\":%u,\"step\":%u,\"points\":%u,\"mode\":\"%s\"}\n",
+      (unsigned int)stream->start, (unsigned int)stream->step, stream->count, bandModeDesc[stream->mode]);
+
+  // Must be read before the queue, so no point is missed
+  bool busy = apiScanBusy;
+  __sync_synchronize();
+
+  const ApiScanPoint *p;
+  while((p = apiScanPoints.front()))
+  {
+    int n = sprintf(line, "[%u,%d,%d]\n", (unsigned int)freqToHz(p->freq, stream->mode), p->rssi, p->snr);
+    if(len + n > maxLen) return(len);
+    memcpy(buf + len, line, n);
+    len += n;
+    apiScanPoints.pop();
+    stream->sent++;
+  }
+
+  // Scan is over once the main loop is done and all points are sent
+  if(!busy && (len + sizeof(line) <= maxLen))
+  {
+    len += sprintf((char *)buf + len, "{\"done\":true,\"points\":%u}\n", stream->sent);
+    stream->done = true;
+  }
+
+  return(len ? len : RESPONSE_TRY_AGAIN);
+}
+
+static void apiScan(AsyncWebServerRequest *request)
+{
+  static const char *const keys[] = { "start", "end", "step", NULL };
+  JsonField fields[API_MAX_FIELDS];
+  int count = 0;
+
+  // Scan takes over the tuner
+  if(!webAuthenticate(request)) return(request->requestAuthentication());
+
+  // Body is optional, the whole current band is scanned by default
+  if(request->contentLength())
+  {
+    count = apiParseBody(request, fields);
+    if(count < 0) return;
+  }
+
+  const JsonField *start = jsonGet(fields, count, "start", JSON_NUMBER);
+  const JsonField *end   = jsonGet(fields, count, "end", JSON_NUMBER);
+  const JsonField *step  = jsonGet(fields, count, "step", JSON_NUMBER);
+
+  if(!jsonOnly(fields, count, keys) || (count != !!start + !!end + !!step))
+    return(apiReply(request, 400, "Expected start, end, or step"));
+
+  // Main loop may change these, webApiLoop() checks them again
+  uint8_t bandNum = bandIdx;
+  uint8_t mode = currentMode;
+  const Band *band = &bands[bandNum];
+  uint16_t first = start && start->num > 0 ? freqFromHz(start->num, mode) : band->minimumFreq;
+  uint16_t last  = end && end->num > 0 ? freqFromHz(end->num, mode) : band->maximumFreq;
+
+  if((start && (start->num <= 0 || !isFreqInBand(band, first))) ||
+     (end && (end->num <= 0 || !isFreqInBand(band, last))) || (last <= first))
+    return(apiReply(request, 400, "Invalid range for the band"));
+
+  // Default step keeps the scan short
+  uint16_t units = step && step->num > 0 ? freqFromHz(step->num, mode) :
+    (last - first + API_SCAN_DEFAULT - 2) / (API_SCAN_DEFAULT - 1);
+  if(!units) return(apiReply(request, 400, "Invalid step"));
+
+  uint32_t points = (last - first) / units + 1;
+  if(points > API_SCAN_POINTS) return(apiReply(request, 400, "Too many points"));
+
+  if(apiScanBusy) return(apiReply(request, 503, "Busy"));
+
+  // Main loop is not scanning, the queue can be reset
+  apiScanPoints.clear();
+  apiScanCancel = false;
+  apiScanBusy = true;
+
+  ApiChange change = {};
+  change.type      = API_SCAN;
+  change.band      = bandNum;
+  change.mode      = mode;
+  change.scanFreq  = first;
+  change.scanStep  = units;
+  change.scanCount = points;
+  if(!apiChanges.push(change))
+  {
+    apiScanBusy = false;
+    return(apiReply(request, 503, "Busy"));
+  }
+
+  ApiScanStream stream = {};
+  stream.id    = ++apiScanId;
+  stream.start = freqToHz(first, mode);
+  stream.step  = freqToHz(units, mode);
+  stream.count = points;
+  stream.mode  = mode;
+
+  uint32_t id = stream.id;
+  request->onDisconnect([id] () { if(id == apiScanId) apiScanCancel = true; });
+
+  AsyncWebServerResponse *response = request->beginChunkedResponse("application/x-ndjson",
+    [stream] (uint8_t *buf, size_t maxLen, size_t index) mutable -> size_t {
+      return(apiScanSend(&stream, buf, maxLen, index));
+    }
+  );
+
+  request->send(response);
+}
+
+// Runs in the main loop, a client that falls a whole queue
+// behind ends the scan rather than holding up the receiver
+static bool apiScanPoint(uint16_t freq, uint8_t rssi, uint8_t snr)
+{
+  ApiScanPoint point = { freq, rssi, snr };
+  return(!apiScanCancel && apiScanPoints.push(point));
+}
+
+void webApiInit(AsyncWebServer *server)
+{
+  server->on("/api/status", HTTP_GET, apiGetStatus);
+  server->on("/api/radio", HTTP_GET, apiGetRadio);
+  server->on("/api/radio", HTTP_PUT, apiPutRadio, NULL, apiReceiveBody);
+
+  // Handlers also serve "<path>/<index>" URLs
+  server->on("/api/memories", HTTP_GET, apiMemories);
+  server->on("/api/memories", HTTP_POST, apiMemories, NULL, apiReceiveBody);
+  server->on("/api/memories", HTTP_PUT, apiMemories, NULL, apiReceiveBody);
+  server->on("/api/memories", HTTP_DELETE, apiMemories);
+  server->on("/api/bands", HTTP_GET, apiBands);
+  server->on("/api/bands", HTTP_PUT, apiBands, NULL, apiReceiveBody);
+  server->on("/api/scan", HTTP_POST, apiScan, NULL, apiReceiveBody);
+}
+
+int webApiLoop()
+{
+  const ApiChange *change;
+  int event = 0;
+
+  while((change = apiChanges.front()))
+  {
+    switch(change->type)
+    {
+      case API_SET_RADIO:
+        apiApplyRadio(change);
+        break;
+      case API_SET_MEMORY:
+        // Cleared slots have zero frequency
+        memories[change->index] = change->memory;
+        break;
+      case API_SET_BAND:
+        apiApplyBand(change);
+        break;
+      case API_SCAN:
+        // Blocks like the scan started from the menu, nothing is
+        // scanned if the band or mode has changed since the request
+        if((change->band == bandIdx) && (change->mode == currentMode))
+          scanStream(change->scanFreq, change->scanStep, change->scanCount, apiScanPoint);
+        __sync_synchronize();
+        apiScanBusy = false;
+        apiChanges.pop();
+        event |= REMOTE_CHANGED;
+        continue;
+    }
+
+    apiChanges.pop();
+    event |= REMOTE_CHANGED | REMOTE_PREFS;
+  }
+
+  return(event);
+}
@@ -0,0 +1,12 @@
+#ifndef WEB_API_H
+#define WEB_API_H
+
+#include <ESPAsyncWebServer.h>
+
+// Register JSON API handlers under /api
+void webApiInit(AsyncWebServer *server);
+
+// Apply changes requested through the API, returns remote events
+int webApiLoop();
+
+#endif
@@ -0,0 +1,495 @@
+// Generated by tools/webassets.py from the web folder, do not edit
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+typedef struct
+{
+  const char *path;       // URL path
+  const char *type;       // Content type
+  const uint8_t *data;    // Gzipped contents
+  size_t size;            // Gzipped size
+  const char *etag;       // Entity tag, changes with the contents
+} WebAsset;
+
+// console.html: 1199 bytes
+static const uint8_t webConsoleHtml[] PROGMEM =
+{
+  0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x8D, 0x56, 0x6D, 0x73, 0xDA, 0x46,
+  0x10, 0xFE, 0xCE, 0xAF, 0xD8, 0x7A, 0x32, 0x39, 0xA9, 0x06, 0x49, 0x38, 0xF1, 0xA4, 0x41, 0x88,
+  0x0E, 0x2F, 0x72, 0xCD, 0x84, 0xB7, 0x01, 0xD9, 0x6D, 0xEA, 0xD2, 0x19, 0x59, 0x3A, 0x81, 0x1A,
+  0xA1, 0xA3, 0x77, 0x07, 0x84, 0xC6, 0xFE, 0xEF, 0xDD, 0x3B, 0x09, 0xEC, 0x78, 0x62, 0x27, 0x5F,
+  0x38, 0x69, 0xF7, 0xD9, 0xE7, 0xF6, 0x5D, 0x34, 0x7F, 0xEA, 0x8D, 0xBB, 0xC1, 0xC7, 0x89, 0x0F,
+  0x97, 0xC1, 0x70, 0xD0, 0xAA, 0x34, 0x0F, 0x87, 0xDF, 0xEE, 0xE1, 0x31, 0xF4, 0x83, 0x36, 0x74,
+  0x2F, 0xDB, 0xD3, 0x99, 0x1F, 0x78, 0xE4, 0x2A, 0xB8, 0xA8, 0xFD, 0x42, 0x0E, 0xE2, 0x51, 0x7B,
+  0xE8, 0x7B, 0x64, 0x9B, 0xD2, 0xDD, 0x9A, 0x71, 0x49, 0xA0, 0x3B, 0x1E, 0x05, 0xFE, 0x08, 0x61,
+  0xBB, 0x34, 0x96, 0x4B, 0x2F, 0xA6, 0xDB, 0x34, 0xA2, 0x35, 0xFD, 0x52, 0x85, 0x34, 0x4F, 0x65,
+  0x1A, 0x66, 0x35, 0x11, 0x85, 0x19, 0xF5, 0xEA, 0x96, 0xA3, 0x68, 0x82, 0x7E, 0x30, 0xF0, 0x5B,
+  0xED, 0x60, 0x56, 0x1B, 0xA2, 0x1E, 0xBA, 0x2C, 0x17, 0x2C, 0xA3, 0x4D, 0xBB, 0x90, 0x57, 0x9A,
+  0x83, 0xFE, 0xE8, 0x03, 0x4C, 0xFD, 0x81, 0x47, 0x84, 0xDC, 0x67, 0x54, 0x2C, 0x29, 0xC5, 0x7B,
+  0x2E, 0xA7, 0xFE, 0x85, 0x47, 0x6C, 0x2D, 0xB2, 0x22, 0x21, 0x14, 0x93, 0x5D, 0xFA, 0xDB, 0x19,
+  0xF7, 0x3E, 0x2A, 0xEF, 0xEB, 0xDF, 0x60, 0x45, 0x61, 0xA5, 0x39, 0x81, 0xF6, 0xA0, 0xFF, 0xDB,
+  0xC8, 0x23, 0x5D, 0x74, 0xD5, 0x9F, 0x2A, 0xDB, 0xF6, 0x81, 0x91, 0xB4, 0x66, 0x32, 0x94, 0x1B,
+  0xD1, 0xB4, 0xDB, 0xAD, 0xCA, 0xEB, 0xFC, 0x56, 0xAC, 0xDD, 0xBB, 0xE2, 0x78, 0xC0, 0xAC, 0xE8,
+  0x8A, 0xF1, 0x3D, 0x69, 0x0D, 0xF5, 0xF9, 0x12, 0x52, 0x44, 0x9C, 0xD2, 0x1C, 0x39, 0xF5, 0xF9,
+  0x32, 0x92, 0xAD, 0xA9, 0x02, 0xE2, 0xF1, 0x12, 0x2E, 0x62, 0x79, 0x92, 0x2E, 0x48, 0xAB, 0xAB,
+  0x4F, 0x8D, 0x6C, 0xDA, 0x13, 0x1D, 0x54, 0xBF, 0xA7, 0x72, 0xA4, 0x9C, 0x27, 0x4F, 0x03, 0x9C,
+  0x70, 0x2A, 0x04, 0x0C, 0xD8, 0x02, 0x24, 0x03, 0xB1, 0x64, 0x3B, 0x90, 0x4B, 0x0A, 0x9C, 0x46,
+  0x34, 0xDD, 0x52, 0x0E, 0xA2, 0x0C, 0x79, 0xF2, 0xED, 0xE4, 0x74, 0xAE, 0x82, 0x60, 0x3C, 0x82,
+  0xF1, 0xA8, 0x3B, 0xE8, 0x77, 0x3F, 0x78, 0x27, 0x82, 0xE6, 0xB1, 0x41, 0x6E, 0x89, 0x79, 0xD2,
+  0xEA, 0x84, 0x79, 0x0C, 0xB5, 0xA6, 0x5D, 0x40, 0x5A, 0xF0, 0x0C, 0xB6, 0x73, 0xC4, 0x9E, 0x1E,
+  0xB1, 0xCF, 0xF1, 0xAE, 0x14, 0x76, 0xC8, 0x62, 0xFA, 0x03, 0xBC, 0xC3, 0x23, 0xF6, 0xFB, 0xBC,
+  0x5C, 0x61, 0x83, 0x4D, 0xFE, 0x23, 0xBC, 0xD3, 0x23, 0xF6, 0xFB, 0xBC, 0x5B, 0x85, 0xBD, 0x66,
+  0xD9, 0x0F, 0xD0, 0x5E, 0x1F, 0xA0, 0xDF, 0x67, 0x95, 0x0A, 0x8A, 0x05, 0x7B, 0x04, 0x2C, 0xCA,
+  0x33, 0xF5, 0x75, 0xA1, 0x33, 0xB6, 0x20, 0x30, 0x0B, 0x3E, 0x0E, 0x70, 0xFC, 0x96, 0x34, 0x5D,
+  0x2C, 0x65, 0x03, 0xCE, 0x1C, 0xBA, 0x72, 0x81, 0x61, 0x45, 0x93, 0x8C, 0xED, 0x6A, 0xFB, 0x06,
+  0x60, 0xFF, 0xB1, 0x2C, 0x73, 0x41, 0xD2, 0xCF, 0xB2, 0x16, 0x66, 0xE9, 0x22, 0x6F, 0x40, 0x46,
+  0x13, 0xE9, 0xC2, 0x6E, 0x99, 0x4A, 0x5A, 0x13, 0xEB, 0x30, 0xA2, 0x0D, 0x58, 0x73, 0x9C, 0x51,
+  0x1E, 0xAE, 0x5D, 0xD2, 0xC2, 0x5B, 0xA6, 0x6A, 0xEC, 0x2E, 0xC6, 0xD3, 0x21, 0xFA, 0x34, 0xBB,
+  0xEA, 0x0C, 0xFB, 0x41, 0xE9, 0x54, 0xB4, 0x8A, 0xAD, 0x6D, 0x98, 0x6D, 0x30, 0x2B, 0x40, 0xFE,
+  0xCA, 0x89, 0xE9, 0xC2, 0x83, 0xC8, 0x03, 0x42, 0x5C, 0x6C, 0x29, 0xB9, 0xE1, 0x39, 0x24, 0x61,
+  0x26, 0xA8, 0x7B, 0x82, 0x3C, 0xFD, 0xD1, 0xE4, 0x2A, 0xD0, 0x1E, 0x23, 0x94, 0x80, 0xDA, 0x32,
+  0x1E, 0x09, 0xFC, 0x3F, 0x02, 0xF4, 0xBE, 0xFF, 0x27, 0x3E, 0xBF, 0x71, 0x08, 0x4C, 0x06, 0xED,
+  0xAE, 0x7F, 0x39, 0x1E, 0xF4, 0xFC, 0x29, 0xF6, 0x1D, 0x5B, 0xAD, 0xB0, 0x53, 0x44, 0x15, 0xA8,
+  0xB5, 0xB0, 0xE0, 0xE2, 0x9D, 0xF3, 0xEE, 0xAD, 0xE3, 0x38, 0xC0, 0x38, 0xBC, 0x22, 0x98, 0xDA,
+  0x82, 0xB1, 0x20, 0x2A, 0xDC, 0x23, 0x70, 0xDD, 0x1E, 0x5C, 0xA9, 0x57, 0xF4, 0x52, 0x6F, 0x02,
+  0xE5, 0x3D, 0x9E, 0xB3, 0xEE, 0xB4, 0x3F, 0x09, 0x5A, 0x95, 0x6D, 0xC8, 0x61, 0x87, 0x84, 0x59,
+  0x9A, 0x17, 0x8E, 0x56, 0x21, 0xA6, 0x11, 0x3E, 0xE5, 0x74, 0x07, 0x01, 0xE6, 0xA6, 0x47, 0x23,
+  0x6C, 0x22, 0x6E, 0x98, 0xAE, 0xC6, 0x62, 0x72, 0x51, 0x19, 0xB3, 0x68, 0xB3, 0xA2, 0xB9, 0xB4,
+  0x16, 0x54, 0xFA, 0x19, 0x55, 0x8F, 0x9D, 0x7D, 0x1F, 0x6B, 0xA3, 0x72, 0x6F, 0x56, 0x55, 0xEC,
+  0x2F, 0xA1, 0x54, 0xBC, 0xC8, 0x97, 0x6C, 0xF2, 0x48, 0xA6, 0x2C, 0x07, 0x9D, 0x42, 0x61, 0xC2,
+  0x17, 0x48, 0x13, 0x63, 0x27, 0xE0, 0xF5, 0x6B, 0xF4, 0xC9, 0xE2, 0x34, 0x8C, 0xF7, 0x6A, 0xE5,
+  0xA0, 0x63, 0x1E, 0xD4, 0x4D, 0x25, 0x2B, 0x91, 0x2E, 0xDC, 0x3F, 0xB2, 0xD6, 0x23, 0x6A, 0x24,
+  0x66, 0xE5, 0x8B, 0x76, 0x31, 0xE1, 0xF4, 0x5F, 0xBC, 0x3D, 0xB9, 0x39, 0x9F, 0x2B, 0x43, 0x72,
+  0x31, 0x24, 0xF0, 0x2B, 0x18, 0xC9, 0x4D, 0x7D, 0x0E, 0x36, 0xD4, 0x1D, 0xC7, 0xB4, 0x24, 0xBB,
+  0x48, 0x3F, 0xD3, 0xD8, 0x38, 0x33, 0x55, 0xBD, 0x60, 0x78, 0xF9, 0x1F, 0x81, 0x06, 0x18, 0x05,
+  0xE6, 0x67, 0x85, 0x71, 0x50, 0x71, 0x9A, 0xDC, 0x9C, 0xCD, 0xCD, 0xC2, 0xC6, 0x29, 0x90, 0x9F,
+  0x10, 0xE9, 0x56, 0x9E, 0x0D, 0xAC, 0xDC, 0x31, 0x78, 0x01, 0x66, 0x0E, 0xF7, 0x90, 0x44, 0x0D,
+  0x78, 0x95, 0xE4, 0xE6, 0xED, 0x5C, 0x9B, 0x13, 0xFC, 0xD5, 0x7E, 0x1D, 0x5F, 0x94, 0xAF, 0xF8,
+  0x52, 0x85, 0x2D, 0xCB, 0x90, 0xB3, 0x44, 0xBC, 0x9F, 0x17, 0xC2, 0xE9, 0x6C, 0xD6, 0x2F, 0x45,
+  0x75, 0xA7, 0xB0, 0x8A, 0x3B, 0x9B, 0xEB, 0x2A, 0xCC, 0x46, 0xD3, 0x83, 0xBC, 0x7E, 0x90, 0x57,
+  0xE1, 0x36, 0x94, 0x92, 0xF2, 0xFD, 0x41, 0xF3, 0xA6, 0xD0, 0x5C, 0xA3, 0xC7, 0x8F, 0xD3, 0x85,
+  0x3B, 0xCE, 0x50, 0xFE, 0x1D, 0xF2, 0xA5, 0x4A, 0x2F, 0x30, 0x61, 0x86, 0xEE, 0x81, 0x53, 0x3D,
+  0x11, 0xA6, 0x25, 0xD6, 0x59, 0x2A, 0x8D, 0xA2, 0x97, 0x2B, 0x65, 0x77, 0x68, 0xA4, 0xB5, 0x66,
+  0x6B, 0xA3, 0x94, 0x09, 0x2B, 0x61, 0xDC, 0x0F, 0xA3, 0xA5, 0x71, 0xA0, 0x37, 0x32, 0x45, 0x9B,
+  0x29, 0x30, 0x16, 0x70, 0x9D, 0xE1, 0x10, 0x21, 0x09, 0xC7, 0x58, 0x08, 0x29, 0x5B, 0x28, 0xD1,
+  0xCA, 0x92, 0xBF, 0xAA, 0xA4, 0x58, 0xF5, 0xC4, 0xCA, 0x68, 0xBE, 0x90, 0x4B, 0x5D, 0xEA, 0x73,
+  0xD5, 0x01, 0xF6, 0xDF, 0x37, 0x4E, 0xED, 0xFD, 0xFC, 0xF4, 0x95, 0x8D, 0xD9, 0x14, 0x12, 0x6B,
+  0xE3, 0xCC, 0x4D, 0xF3, 0xA1, 0xDA, 0x6E, 0x85, 0xE2, 0x24, 0xA9, 0x86, 0xFC, 0x2A, 0xDB, 0xA7,
+  0x48, 0x5E, 0x0E, 0x21, 0x86, 0xAD, 0xFC, 0x7C, 0x02, 0xF0, 0x9E, 0x9A, 0x3C, 0x0E, 0xD5, 0x12,
+  0x19, 0x7E, 0x95, 0x8D, 0xDA, 0xB9, 0xEA, 0x92, 0x7F, 0x58, 0x9A, 0x1F, 0x33, 0x80, 0x36, 0xC5,
+  0xCA, 0x08, 0xD8, 0xBA, 0xE4, 0x28, 0xDE, 0x2F, 0xF5, 0x8A, 0xF9, 0x2A, 0xC5, 0xF8, 0x25, 0xCA,
+  0x69, 0x24, 0x0D, 0x95, 0x8A, 0x9D, 0x28, 0x87, 0xE9, 0x77, 0x7A, 0x3B, 0x63, 0xD1, 0x27, 0x8A,
+  0x37, 0xED, 0x44, 0xC3, 0xB6, 0x55, 0x91, 0x32, 0x16, 0x85, 0xCA, 0xC2, 0x5A, 0x32, 0x21, 0x95,
+  0xD7, 0xF6, 0x4E, 0xD8, 0x1C, 0xBF, 0x9D, 0x92, 0xAA, 0x4B, 0xB1, 0xE1, 0x6F, 0xD3, 0x3C, 0xE4,
+  0xFB, 0x60, 0xBF, 0xD6, 0xD3, 0x19, 0x72, 0x1E, 0xEE, 0x6F, 0x37, 0x49, 0x42, 0x39, 0xD1, 0x6A,
+  0x96, 0xAF, 0xF0, 0xF3, 0x15, 0x2E, 0x94, 0xF6, 0x58, 0x02, 0xAA, 0x26, 0x49, 0x97, 0x19, 0x47,
+  0xD9, 0x8A, 0xF5, 0x00, 0x1B, 0xD4, 0x8A, 0x43, 0x19, 0x56, 0x95, 0x46, 0xE2, 0x64, 0xAD, 0x1A,
+  0x20, 0x39, 0xEE, 0xA6, 0x7B, 0x53, 0x0D, 0x53, 0xC9, 0x15, 0x65, 0x4C, 0x3C, 0xC3, 0x84, 0xF6,
+  0x68, 0x25, 0x30, 0xB8, 0xBB, 0x3B, 0x20, 0xBD, 0x54, 0x94, 0x31, 0x52, 0x9C, 0x64, 0x9D, 0x6E,
+  0x5E, 0x6C, 0x3D, 0x41, 0x65, 0x90, 0xAE, 0x28, 0xDB, 0x48, 0xA3, 0x44, 0x54, 0x71, 0xF9, 0x62,
+  0x36, 0xF5, 0x2D, 0xF7, 0x95, 0x63, 0x6A, 0x5C, 0xDC, 0x45, 0x87, 0x25, 0x84, 0x9B, 0xBC, 0xF8,
+  0x63, 0x62, 0x17, 0x7F, 0xAF, 0xFE, 0x07, 0xC8, 0x9E, 0x18, 0x6E, 0x76, 0x09, 0x00, 0x00,
+};
+
+// scope.html: 2494 bytes
+static const uint8_t webScopeHtml[] PROGMEM =
+{
+  0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xAD, 0x58, 0xEB, 0x73, 0x9B, 0x48,
+  0x12, 0xFF, 0xAE, 0xBF, 0xA2, 0xBD, 0x5B, 0x1B, 0x20, 0x46, 0x48, 0xB2, 0x9D, 0x3A, 0x97, 0x5E,
+  0x57, 0xB2, 0x8C, 0xD7, 0xDA, 0xE8, 0xE1, 0x92, 0x94, 0x4D, 0x72, 0x3E, 0x7F, 0xC0, 0x30, 0x08,
+  0x62, 0x04, 0x14, 0x8C, 0x1E, 0x5E, 0xC7, 0xFF, 0xFB, 0x75, 0xCF, 0x00, 0x42, 0xB2, 0xD7, 0xC9,
+  0x56, 0x5D, 0x2A, 0x65, 0xE6, 0xD1, 0xD3, 0xD3, 0x8F, 0x5F, 0x3F, 0x46, 0xED, 0xA3, 0xCB, 0x49,
+  0x7F, 0xFE, 0xF5, 0xC6, 0x84, 0xEB, 0xF9, 0x68, 0xD8, 0xAD, 0xB4, 0xF3, 0x8F, 0xD9, 0xBB, 0xC4,
+  0xCF, 0xC8, 0x9C, 0xF7, 0xA0, 0x7F, 0xDD, 0x9B, 0xCE, 0xCC, 0x79, 0x47, 0xF9, 0x34, 0xBF, 0xAA,
+  0x9E, 0x2B, 0xF9, 0xF2, 0xB8, 0x37, 0x32, 0x3B, 0xCA, 0xDA, 0x67, 0x9B, 0x38, 0x4A, 0xB8, 0x02,
+  0xFD, 0xC9, 0x78, 0x6E, 0x8E, 0x91, 0x6C, 0xE3, 0x3B, 0xDC, 0xEB, 0x38, 0x6C, 0xED, 0xDB, 0xAC,
+  0x2A, 0x26, 0x3A, 0xF8, 0xA1, 0xCF, 0x7D, 0x2B, 0xA8, 0xA6, 0xB6, 0x15, 0xB0, 0x4E, 0xC3, 0xA8,
+  0x13, 0x9B, 0xF9, 0x60, 0x3E, 0x34, 0xBB, 0xBD, 0xF9, 0xAC, 0x3A, 0xC2, 0x7D, 0xB8, 0xB0, 0x42,
+  0x07, 0x66, 0x76, 0x14, 0xB3, 0x76, 0x4D, 0x6E, 0x55, 0xDA, 0xC3, 0xC1, 0xF8, 0x23, 0x4C, 0xCD,
+  0x61, 0x47, 0x49, 0xF9, 0x63, 0xC0, 0x52, 0x8F, 0x31, 0xBC, 0xEA, 0x7A, 0x6A, 0x5E, 0x75, 0x94,
+  0x9A, 0x58, 0x32, 0xEC, 0x34, 0x25, 0x66, 0xB5, 0x4C, 0xE4, 0x8B, 0xC9, 0xE5, 0x57, 0x52, 0xA0,
+  0xF1, 0x3A, 0x63, 0x5C, 0xAF, 0xB4, 0x6F, 0xA0, 0x37, 0x1C, 0xFC, 0x3E, 0xEE, 0x28, 0x7D, 0x14,
+  0xD8, 0x9C, 0xD2, 0xF1, 0x5E, 0xCE, 0x54, 0xE9, 0xCE, 0xB8, 0xC5, 0x57, 0x69, 0xBB, 0xD6, 0xEB,
+  0x56, 0xDE, 0x85, 0xF7, 0x69, 0xDC, 0xFA, 0x2E, 0x3F, 0x3B, 0x9A, 0x25, 0x5B, 0x46, 0xC9, 0xA3,
+  0xD2, 0x1D, 0x89, 0xEF, 0x5B, 0x94, 0xA9, 0x9D, 0x30, 0x16, 0x22, 0x4F, 0xF1, 0x7D, 0x8B, 0xD2,
+  0x8E, 0xC2, 0x34, 0x0A, 0x98, 0xD2, 0xED, 0xCB, 0xC1, 0x0F, 0x68, 0x5D, 0x7F, 0x21, 0x48, 0xF1,
+  0x2B, 0x28, 0xDB, 0xB5, 0x1B, 0xFC, 0x73, 0x35, 0x99, 0x8E, 0x60, 0x32, 0x9E, 0x7D, 0xBA, 0x18,
+  0x0D, 0xE6, 0x9D, 0x5F, 0x52, 0x1E, 0xC5, 0x31, 0x73, 0xA0, 0x03, 0xAE, 0x15, 0xA4, 0xAC, 0x05,
+  0x68, 0xFE, 0x50, 0xD5, 0x5A, 0x90, 0x30, 0xBE, 0x4A, 0xC2, 0x6C, 0xF5, 0x17, 0xE8, 0x0F, 0x7B,
+  0xB3, 0x59, 0xD9, 0x1A, 0x83, 0xF1, 0xCD, 0xA7, 0x39, 0x0C, 0x2E, 0xC9, 0xEC, 0x16, 0x39, 0x97,
+  0x20, 0xD2, 0x51, 0xC6, 0x9F, 0x46, 0x17, 0x48, 0x00, 0xB3, 0xB9, 0x79, 0xD3, 0x51, 0xAC, 0xF0,
+  0x51, 0x81, 0x9B, 0x61, 0xAF, 0x6F, 0x5E, 0x4F, 0x86, 0x97, 0xE6, 0xB4, 0xA3, 0xCC, 0x88, 0x58,
+  0x87, 0x87, 0xEB, 0xBF, 0x88, 0xE6, 0xEB, 0xD0, 0xCC, 0xC0, 0xD0, 0x84, 0x7F, 0xB1, 0x65, 0x6B,
+  0x9F, 0x31, 0x0B, 0x9D, 0x9F, 0x65, 0x6B, 0x86, 0xCE, 0x4F, 0x32, 0x4D, 0x39, 0x8B, 0x7F, 0x5E,
+  0x58, 0x16, 0xBF, 0xC9, 0x76, 0xD8, 0xBB, 0x30, 0x87, 0xDD, 0x12, 0xF7, 0x84, 0xC5, 0xCC, 0x2A,
+  0x8C, 0xD1, 0xBF, 0x36, 0xFB, 0x1F, 0x2F, 0x26, 0x5F, 0x94, 0x2E, 0x4C, 0xC5, 0x46, 0xBB, 0x26,
+  0x4F, 0x20, 0x06, 0x3F, 0xCD, 0xE7, 0x93, 0x71, 0x46, 0x27, 0x9D, 0x41, 0x10, 0xB0, 0x10, 0x00,
+  0x72, 0xAB, 0x0B, 0xFB, 0x34, 0x72, 0xA2, 0xA0, 0xEB, 0xFA, 0xC3, 0x41, 0xFF, 0x23, 0x29, 0x12,
+  0xC5, 0xAA, 0x46, 0x58, 0x8C, 0xE2, 0xE2, 0x50, 0xE5, 0x07, 0x87, 0xFE, 0x8A, 0xA2, 0xA5, 0x5A,
+  0x37, 0x3E, 0xE8, 0x80, 0x7F, 0xF0, 0xF0, 0x7F, 0x70, 0x0E, 0xC7, 0x3F, 0x7D, 0xA7, 0x38, 0x7E,
+  0xB2, 0x77, 0xB8, 0xFA, 0xD3, 0x77, 0x53, 0x1E, 0x40, 0x9C, 0x85, 0xAB, 0x20, 0x68, 0x81, 0x93,
+  0x58, 0x1B, 0x92, 0x7E, 0xCA, 0x52, 0xC6, 0x4B, 0x2C, 0x6A, 0x84, 0x4F, 0x11, 0x7F, 0x19, 0xB4,
+  0x30, 0xCE, 0x94, 0xC3, 0x58, 0x1C, 0x32, 0x6B, 0xCD, 0x80, 0x7B, 0x0C, 0x5C, 0x9F, 0x05, 0x4E,
+  0x0A, 0x6C, 0x19, 0xF3, 0x47, 0xE0, 0x91, 0x40, 0xAF, 0xD8, 0xD8, 0x78, 0x18, 0x20, 0x60, 0xAF,
+  0x92, 0x84, 0x85, 0x1C, 0xEE, 0x31, 0xBC, 0x25, 0xFC, 0x5F, 0x89, 0xEB, 0x7E, 0x6F, 0xFC, 0x67,
+  0x6F, 0x26, 0xEF, 0x8B, 0x99, 0xCD, 0x93, 0xD5, 0x52, 0x81, 0xCF, 0x83, 0xCB, 0xF9, 0x75, 0x47,
+  0x69, 0xD4, 0xEB, 0x75, 0x4C, 0x26, 0xE6, 0xE0, 0xF7, 0x6B, 0x4C, 0x5B, 0x27, 0x1F, 0xEA, 0x87,
+  0x48, 0x40, 0x82, 0xDF, 0x5A, 0xB0, 0xB4, 0xB6, 0xD5, 0xDD, 0x42, 0x3D, 0xDE, 0x22, 0x3A, 0xDA,
+  0x35, 0xC9, 0xB8, 0xDB, 0xBE, 0x98, 0xEE, 0xDF, 0xB2, 0xB1, 0x38, 0x4B, 0x30, 0xB0, 0x82, 0xFF,
+  0xEB, 0x35, 0x59, 0x7C, 0xCF, 0xFA, 0xD3, 0xC1, 0xCD, 0xBC, 0x5B, 0x59, 0x5B, 0x09, 0xE4, 0xEA,
+  0xA0, 0xD5, 0x9D, 0xC8, 0x5E, 0x2D, 0xD1, 0x14, 0xC6, 0x82, 0x71, 0x33, 0x60, 0x34, 0xBC, 0x78,
+  0x1C, 0x38, 0xEA, 0x4E, 0x65, 0x4D, 0x87, 0x42, 0xB0, 0xB7, 0x0E, 0xEC, 0xA4, 0xD7, 0x5A, 0xE2,
+  0x96, 0xE9, 0xE4, 0x33, 0xD2, 0x9F, 0xE9, 0x34, 0x98, 0xE1, 0xA8, 0x20, 0x30, 0x3C, 0xE6, 0x2F,
+  0x3C, 0x0E, 0x35, 0xDA, 0xD1, 0x61, 0xD4, 0xFB, 0x82, 0xBB, 0xE7, 0x75, 0x79, 0x8A, 0x3C, 0x95,
+  0xE2, 0xFC, 0xF6, 0x4E, 0x87, 0x12, 0x32, 0x74, 0xB0, 0xEE, 0xB1, 0x56, 0x14, 0xB3, 0x83, 0xFC,
+  0xA4, 0x13, 0x70, 0x16, 0x39, 0x8A, 0x2A, 0xEE, 0x2A, 0xB4, 0xB9, 0x1F, 0x85, 0x20, 0x81, 0xA2,
+  0xA6, 0x1A, 0x3C, 0xBD, 0xA1, 0xAA, 0x44, 0x93, 0x66, 0x70, 0xB6, 0xE5, 0x98, 0x18, 0x39, 0x41,
+  0xA3, 0x03, 0x69, 0x0B, 0x9E, 0x77, 0x9C, 0xDC, 0x25, 0x57, 0x5D, 0x62, 0x93, 0x27, 0x40, 0xE8,
+  0x76, 0xE0, 0xB4, 0x2E, 0xFF, 0xC1, 0xBF, 0x41, 0x75, 0x51, 0x9F, 0x86, 0x9C, 0x22, 0xA7, 0xE8,
+  0xCA, 0xDF, 0x32, 0x47, 0x3D, 0xD1, 0xE0, 0x18, 0x14, 0x18, 0x51, 0xAA, 0x68, 0xC2, 0x71, 0x41,
+  0xB4, 0xA3, 0x38, 0x95, 0x14, 0x94, 0x4C, 0xF6, 0xEE, 0x43, 0x51, 0x50, 0x0C, 0x55, 0xAB, 0x3C,
+  0x49, 0xB3, 0x90, 0x40, 0x64, 0x9A, 0xDB, 0xFA, 0x5D, 0xAB, 0x92, 0xC9, 0x90, 0xE2, 0xBD, 0x4F,
+  0x10, 0x44, 0x4D, 0x48, 0x8D, 0x54, 0x26, 0x50, 0xCF, 0x2F, 0x26, 0xC8, 0x97, 0x46, 0x2C, 0x86,
+  0xF7, 0x30, 0xB2, 0xB8, 0x67, 0x20, 0x4C, 0xD4, 0xD4, 0x88, 0x23, 0x3F, 0xE4, 0x29, 0x54, 0xA1,
+  0xA1, 0x43, 0x43, 0x83, 0x67, 0x94, 0x4B, 0xF2, 0xA8, 0xCB, 0xD3, 0x0D, 0x78, 0x6E, 0x55, 0x4A,
+  0x82, 0x6C, 0x55, 0x17, 0x3D, 0x81, 0x20, 0x28, 0x29, 0x8F, 0x7A, 0x54, 0x61, 0x6D, 0x04, 0x91,
+  0x86, 0xFA, 0xA8, 0x6B, 0xC3, 0xF3, 0x8B, 0xF9, 0x7B, 0xD8, 0xEC, 0xE9, 0x61, 0x47, 0x41, 0x94,
+  0xA8, 0x6B, 0xA1, 0x07, 0xEA, 0x50, 0x08, 0x82, 0xB7, 0xC9, 0xB1, 0x1F, 0xAA, 0x28, 0xC9, 0x1A,
+  0x19, 0x21, 0x10, 0x34, 0xAD, 0x50, 0x4E, 0xF1, 0xD2, 0x40, 0x55, 0x50, 0x09, 0x41, 0x96, 0x44,
+  0xAB, 0x10, 0xCD, 0x79, 0x56, 0xC7, 0x8B, 0xE8, 0xEF, 0x7B, 0x58, 0x0B, 0xC3, 0xE9, 0x14, 0x01,
+  0xFA, 0x01, 0x59, 0xA3, 0x8E, 0xF3, 0xB3, 0x0F, 0x05, 0xD1, 0x6F, 0x9A, 0xB2, 0xA7, 0x12, 0x25,
+  0x99, 0x59, 0x86, 0xEF, 0x4C, 0x34, 0x34, 0xB1, 0x4D, 0x26, 0xCE, 0x56, 0x09, 0x23, 0x02, 0x09,
+  0x5B, 0xAE, 0x2A, 0x27, 0x8E, 0x08, 0x82, 0xF2, 0x76, 0xD6, 0x9B, 0x78, 0xE5, 0x35, 0x89, 0x6A,
+  0xFD, 0xC0, 0x55, 0xB6, 0xE1, 0xFA, 0x41, 0x30, 0xA3, 0x7E, 0x03, 0xD7, 0x95, 0x5F, 0x29, 0xA2,
+  0xF3, 0xD5, 0x29, 0x9E, 0x24, 0x43, 0xE0, 0xFF, 0x0D, 0x32, 0xD3, 0x68, 0x3D, 0xE5, 0x49, 0xF4,
+  0xC0, 0x76, 0xF4, 0xA7, 0xA7, 0xA7, 0xCA, 0x4B, 0x2E, 0xE7, 0xE7, 0xE7, 0x72, 0x35, 0x12, 0x50,
+  0x55, 0x1A, 0x67, 0xF1, 0x16, 0x52, 0xBC, 0xB3, 0x9A, 0xB2, 0xC4, 0x77, 0x71, 0xCF, 0x25, 0xAB,
+  0xA3, 0x56, 0x3E, 0x6E, 0xD7, 0xA1, 0x85, 0xDF, 0x76, 0x07, 0xA1, 0x47, 0xA3, 0xE3, 0xE3, 0x5C,
+  0xE5, 0xC5, 0x36, 0x77, 0x89, 0x34, 0x9C, 0x4F, 0xEE, 0x13, 0x10, 0x25, 0xBB, 0x61, 0x36, 0xA7,
+  0x3B, 0xEE, 0xD9, 0xC2, 0x0F, 0x6F, 0x90, 0x88, 0xCA, 0xBF, 0x6D, 0x2C, 0xA3, 0x35, 0x9B, 0x47,
+  0xEA, 0x62, 0x8B, 0x72, 0x8B, 0x85, 0xC0, 0x0F, 0xF3, 0x05, 0x4F, 0x2C, 0x48, 0x15, 0x90, 0xBA,
+  0xE2, 0xBB, 0xC8, 0xB2, 0x2D, 0xD8, 0x49, 0x0D, 0xE6, 0x64, 0x50, 0x0A, 0x25, 0x02, 0x0B, 0x5E,
+  0x71, 0x88, 0x1D, 0x5F, 0x5E, 0xAE, 0x93, 0x64, 0xC7, 0x70, 0x4A, 0x16, 0xAE, 0xC2, 0x99, 0x26,
+  0xBC, 0x97, 0x29, 0xE4, 0xDC, 0xA3, 0xCC, 0x27, 0xA4, 0x08, 0x8E, 0xDA, 0x22, 0x7B, 0x88, 0xE1,
+  0x31, 0xAD, 0x16, 0x8A, 0x3D, 0xEE, 0x2B, 0x46, 0x6C, 0x90, 0x46, 0x60, 0x0C, 0xAF, 0xF1, 0x7E,
+  0xA8, 0x1E, 0xBA, 0x64, 0xF1, 0x58, 0x56, 0x6F, 0x53, 0x2C, 0xEC, 0xD4, 0x2B, 0xE9, 0x44, 0x02,
+  0x60, 0x18, 0x3B, 0x17, 0x8A, 0x4E, 0x62, 0xE3, 0xFD, 0x55, 0x38, 0x15, 0x72, 0xA3, 0x0D, 0x8E,
+  0x30, 0xFF, 0x48, 0x54, 0xB7, 0x2A, 0xB7, 0xB7, 0x88, 0x76, 0xE5, 0xD7, 0xAB, 0xAB, 0xBA, 0x82,
+  0x19, 0xEE, 0xF6, 0x84, 0x26, 0xF5, 0xFE, 0x95, 0x72, 0x77, 0x87, 0xCE, 0x4C, 0x4C, 0xCB, 0xF6,
+  0xD4, 0x1C, 0xA7, 0x2A, 0x27, 0x75, 0x0E, 0x21, 0xC1, 0x6F, 0x1B, 0x77, 0x87, 0x72, 0x57, 0x30,
+  0xAC, 0x79, 0xFA, 0x92, 0x01, 0x76, 0x29, 0xDF, 0x72, 0x93, 0xC4, 0xE4, 0xEB, 0xAD, 0x1A, 0x23,
+  0x2A, 0xB3, 0x78, 0xD6, 0x21, 0x26, 0x33, 0x91, 0x6D, 0x8A, 0x50, 0x8C, 0x6F, 0x39, 0x12, 0xDC,
+  0x89, 0xAC, 0xAC, 0xED, 0xEC, 0x25, 0x5C, 0xF9, 0x4D, 0xDB, 0x99, 0x23, 0xDE, 0xD2, 0x69, 0xB4,
+  0x07, 0xC3, 0xEC, 0xBB, 0x33, 0x5B, 0xBE, 0x5C, 0x79, 0x2E, 0x81, 0x59, 0xCD, 0xE6, 0x07, 0x11,
+  0xF8, 0x39, 0xAF, 0x07, 0xFB, 0x21, 0xB8, 0x2B, 0x13, 0xAF, 0xC7, 0xE0, 0x6E, 0x5F, 0x04, 0xE1,
+  0x3F, 0x89, 0xB0, 0xC3, 0x0A, 0x44, 0x86, 0xA3, 0x40, 0x7D, 0x69, 0xB8, 0x54, 0x87, 0x24, 0xDA,
+  0x14, 0xA6, 0xDB, 0x94, 0x33, 0x57, 0x23, 0xCB, 0x5C, 0x36, 0xF3, 0x03, 0x95, 0x32, 0xEA, 0x7E,
+  0xB6, 0xCD, 0x93, 0x65, 0x15, 0x8A, 0xBD, 0x6C, 0x49, 0x7B, 0xC3, 0x51, 0xD2, 0xD3, 0x65, 0x45,
+  0x64, 0xE2, 0x8C, 0xD1, 0xDB, 0xDA, 0x9E, 0x36, 0xE2, 0x6E, 0x37, 0x88, 0x70, 0x73, 0xCF, 0x9B,
+  0x78, 0x61, 0x4C, 0xB1, 0x7B, 0xA2, 0x09, 0xD9, 0xD1, 0x6B, 0xA2, 0xBA, 0xC6, 0x1B, 0x51, 0x80,
+  0x73, 0x17, 0xBC, 0x74, 0x43, 0x51, 0x62, 0x28, 0x3D, 0x8B, 0x8A, 0xFB, 0xFD, 0x7B, 0x51, 0x7D,
+  0x5A, 0x95, 0x83, 0x5C, 0x29, 0x17, 0xCA, 0xAE, 0xDB, 0x63, 0x28, 0x1A, 0xC1, 0x07, 0x2C, 0xD6,
+  0xFC, 0x2D, 0xAE, 0x3A, 0x90, 0x82, 0xBB, 0x99, 0x4B, 0x34, 0xAF, 0x27, 0x04, 0x8B, 0xCB, 0xB6,
+  0x00, 0x37, 0xB1, 0xD4, 0xE3, 0x46, 0xA9, 0xF4, 0xBC, 0x87, 0x07, 0x2A, 0x59, 0x62, 0x63, 0x77,
+  0xD2, 0x15, 0x1B, 0x02, 0xB0, 0x62, 0x8E, 0x27, 0xB1, 0x52, 0x33, 0xB9, 0xC9, 0xC4, 0xC1, 0x27,
+  0x78, 0xA5, 0xE7, 0xCC, 0x9F, 0x36, 0x54, 0xBD, 0xF0, 0x2C, 0x1E, 0x6B, 0x17, 0xE4, 0x78, 0xF6,
+  0xB8, 0x23, 0x66, 0x82, 0x61, 0x4B, 0x8A, 0x43, 0xF3, 0x8C, 0x1A, 0x09, 0xBA, 0xE2, 0x0E, 0x4D,
+  0x14, 0x53, 0xA8, 0x76, 0x20, 0xBB, 0xCF, 0xF3, 0x5B, 0x52, 0x46, 0x39, 0x7C, 0xAE, 0x64, 0x57,
+  0xCB, 0x9A, 0x1B, 0x44, 0xB2, 0xE8, 0x22, 0xC5, 0xB3, 0x34, 0xAD, 0xBA, 0x6F, 0x50, 0x0A, 0x37,
+  0x35, 0xC8, 0x8D, 0x49, 0xFD, 0xCE, 0x1F, 0xB3, 0xC9, 0xD8, 0x88, 0xAD, 0x24, 0xA5, 0xF5, 0xC3,
+  0x6A, 0x83, 0xA2, 0xF4, 0x92, 0xC4, 0x7A, 0x34, 0xFC, 0x54, 0x7C, 0x55, 0x47, 0xA3, 0xB3, 0x12,
+  0x75, 0xF1, 0x2A, 0xF5, 0x70, 0x01, 0x41, 0x28, 0xBB, 0x22, 0x85, 0xDE, 0x15, 0xA1, 0x1F, 0x2E,
+  0x40, 0x11, 0xE8, 0x5D, 0x46, 0x0E, 0xA3, 0x2C, 0xD6, 0xCC, 0xE6, 0x74, 0x26, 0x60, 0xE1, 0x82,
+  0x7B, 0x22, 0xB7, 0x45, 0x6E, 0xBE, 0x2E, 0x3B, 0x08, 0x5A, 0x93, 0x43, 0x5D, 0x6C, 0x50, 0x5A,
+  0x77, 0x50, 0x0A, 0x4D, 0x68, 0x20, 0xF2, 0x02, 0x8A, 0xE3, 0x18, 0x4E, 0x14, 0x32, 0x0D, 0xF6,
+  0xEE, 0xC4, 0xC6, 0x8D, 0x4E, 0x38, 0x2F, 0x59, 0x51, 0xF3, 0x48, 0x47, 0x33, 0x85, 0xCB, 0x38,
+  0xC9, 0x83, 0x75, 0x15, 0xA6, 0x9E, 0xEF, 0x72, 0xF5, 0x09, 0x44, 0x70, 0x35, 0x91, 0x4D, 0x16,
+  0x65, 0x14, 0x7E, 0x72, 0x4A, 0x61, 0x28, 0x19, 0x36, 0x8B, 0x5B, 0x74, 0x20, 0x05, 0x69, 0x4E,
+  0x5F, 0xDC, 0xA7, 0xCD, 0xDB, 0x3B, 0x78, 0x2E, 0x38, 0x67, 0xCA, 0x76, 0x76, 0xE9, 0xB0, 0xBC,
+  0x2E, 0x1B, 0x59, 0x24, 0xAE, 0xD5, 0xE0, 0x23, 0xC3, 0xB6, 0x8A, 0xC0, 0x8E, 0x0F, 0x0A, 0x3F,
+  0x90, 0x6F, 0x8E, 0xC4, 0x0A, 0x17, 0x8C, 0x64, 0x7A, 0x4C, 0xC5, 0x3C, 0xB5, 0x96, 0x8C, 0x1C,
+  0x92, 0xCB, 0x4F, 0xE8, 0x39, 0xCA, 0x50, 0x54, 0x0A, 0x06, 0x02, 0xE6, 0x51, 0x27, 0x03, 0x4F,
+  0x19, 0x97, 0x68, 0xC4, 0x12, 0x10, 0xE4, 0xFB, 0x3B, 0x33, 0xCB, 0x7D, 0xE4, 0x50, 0xE6, 0x7E,
+  0x42, 0xCC, 0xDC, 0x66, 0xEF, 0x6C, 0xF4, 0x01, 0xBD, 0x8B, 0xF1, 0x23, 0x5E, 0xB2, 0xAF, 0x54,
+  0x93, 0x87, 0x72, 0x48, 0x0A, 0x00, 0x5D, 0x05, 0x91, 0x85, 0x3E, 0xFB, 0x9B, 0xBE, 0xF8, 0x41,
+  0x33, 0xD6, 0x56, 0xB0, 0x62, 0xB2, 0x8E, 0xAF, 0x11, 0xE0, 0x58, 0xC6, 0xE9, 0xE6, 0xDB, 0x87,
+  0xBB, 0xFD, 0xEA, 0xBA, 0xC6, 0x88, 0x13, 0x5D, 0xAD, 0x4C, 0x30, 0x45, 0xA7, 0x8E, 0xBA, 0xF4,
+  0x68, 0x4C, 0x59, 0x3C, 0x89, 0x82, 0x80, 0x25, 0xE4, 0x45, 0x97, 0x71, 0x14, 0x4B, 0xA9, 0x59,
+  0xB1, 0x5F, 0x23, 0xAD, 0x50, 0xE6, 0x27, 0x58, 0x32, 0xEE, 0x45, 0x0E, 0x22, 0xEF, 0x66, 0x32,
+  0x9B, 0xE3, 0x0A, 0xDD, 0xD3, 0x94, 0x58, 0xC7, 0x22, 0x82, 0x18, 0xF5, 0xDD, 0x47, 0x95, 0x16,
+  0x09, 0xF2, 0xFE, 0x22, 0xB4, 0x82, 0xA6, 0x7C, 0x11, 0x18, 0x72, 0x86, 0x5E, 0xAC, 0x18, 0x68,
+  0xF5, 0x70, 0xA7, 0x6F, 0x42, 0xFA, 0x52, 0xF5, 0x4D, 0x8C, 0xE8, 0x21, 0x2F, 0xC0, 0x90, 0x18,
+  0xDF, 0x52, 0xDC, 0xD4, 0x0E, 0x88, 0x19, 0x05, 0x2E, 0xF7, 0x28, 0x71, 0x92, 0xD8, 0x66, 0x92,
+  0x60, 0x7E, 0x65, 0x06, 0xA3, 0x2F, 0x79, 0x2B, 0x31, 0x24, 0x80, 0xA9, 0xD8, 0x63, 0xAA, 0x78,
+  0xCE, 0xDE, 0x38, 0x09, 0xB3, 0x1C, 0x96, 0xA0, 0xAE, 0x89, 0x41, 0xC2, 0x91, 0x09, 0xA7, 0x62,
+  0x89, 0xD2, 0x9A, 0xC3, 0xEC, 0xCC, 0x0A, 0x74, 0xEA, 0x92, 0xD9, 0x51, 0xB6, 0x91, 0xB0, 0x54,
+  0x74, 0x6D, 0x4A, 0xE9, 0xA5, 0x12, 0xAF, 0x96, 0xB1, 0xF0, 0x6F, 0x2E, 0xA7, 0x60, 0x63, 0xD0,
+  0xE7, 0x85, 0xB0, 0x4E, 0xA6, 0x59, 0x1E, 0x5B, 0x79, 0x6F, 0x21, 0x12, 0x25, 0x26, 0x0C, 0xCA,
+  0x09, 0xAA, 0xB8, 0xE4, 0x98, 0x84, 0x30, 0x1C, 0x71, 0x35, 0x92, 0x0B, 0x7F, 0x92, 0xB9, 0xD1,
+  0xA6, 0xCC, 0x5A, 0x36, 0x01, 0xB3, 0x3A, 0x43, 0x65, 0x34, 0x23, 0x8D, 0x03, 0x1F, 0xCB, 0xEC,
+  0x7F, 0x43, 0x45, 0x74, 0xE0, 0x42, 0x3E, 0xC1, 0x0A, 0x83, 0x27, 0x26, 0xAF, 0xC9, 0x49, 0x0E,
+  0x2A, 0x9A, 0x69, 0xBB, 0x84, 0x95, 0xC9, 0x2C, 0x75, 0xC8, 0xAB, 0xCC, 0x8B, 0xC5, 0x43, 0x07,
+  0x91, 0xC9, 0x49, 0x8B, 0xBF, 0x7B, 0x97, 0x65, 0x3F, 0x9A, 0x68, 0x86, 0xED, 0x31, 0xFB, 0x01,
+  0x73, 0xC6, 0xBB, 0x77, 0x70, 0x94, 0x3D, 0xFC, 0xB4, 0xE2, 0x07, 0x29, 0xE2, 0x6B, 0x5B, 0xBC,
+  0x8C, 0x74, 0x96, 0x71, 0x2E, 0x11, 0xCB, 0xEC, 0xC3, 0x8C, 0x25, 0x4B, 0x53, 0x6B, 0xC1, 0x32,
+  0x17, 0x96, 0xE3, 0x4B, 0xFC, 0x6C, 0x42, 0xB9, 0xB2, 0x78, 0x59, 0x92, 0x71, 0x04, 0xF6, 0x05,
+  0xD0, 0xB4, 0x0C, 0x6F, 0xE2, 0xAF, 0x5A, 0xCE, 0xA2, 0xF2, 0x80, 0x22, 0xF8, 0x15, 0xAF, 0x81,
+  0x28, 0xDC, 0x78, 0x8C, 0xD1, 0x8B, 0xB9, 0x24, 0x16, 0xB2, 0x67, 0x46, 0x9C, 0xB0, 0x35, 0xEA,
+  0x78, 0xC9, 0x5C, 0x6B, 0x15, 0x08, 0x4E, 0x02, 0x49, 0x07, 0xAF, 0x8F, 0x0B, 0x8A, 0x2C, 0xC4,
+  0x7D, 0x3F, 0xF0, 0x91, 0x58, 0x54, 0x7E, 0xA4, 0x14, 0xF5, 0x95, 0xA1, 0x43, 0x03, 0x6E, 0x7D,
+  0xC5, 0x02, 0x45, 0x2F, 0xCF, 0xBA, 0x71, 0x8E, 0x6F, 0xB8, 0x86, 0x71, 0xF2, 0x41, 0x07, 0xDC,
+  0xB3, 0xC5, 0x81, 0x2F, 0x58, 0x7C, 0x12, 0x4C, 0x5C, 0x2E, 0xA7, 0x2E, 0x2E, 0x91, 0xBD, 0x12,
+  0x49, 0xD8, 0x2A, 0x8B, 0xB8, 0x8C, 0x56, 0x29, 0x73, 0xA2, 0x4D, 0xB8, 0x2F, 0x26, 0x3D, 0x96,
+  0xE5, 0x73, 0xFA, 0x09, 0xB6, 0x4D, 0x28, 0x78, 0x62, 0xA7, 0xD1, 0x7C, 0x51, 0xCC, 0xB1, 0x70,
+  0x51, 0xED, 0xDA, 0xF8, 0x21, 0x32, 0xCA, 0x79, 0xAE, 0xE2, 0x32, 0xC7, 0x12, 0x43, 0x59, 0x71,
+  0x5F, 0xD0, 0x53, 0xFB, 0xF8, 0xC2, 0x54, 0xE4, 0x41, 0x71, 0x0C, 0x6F, 0x3B, 0xA2, 0x6B, 0xF7,
+  0x91, 0xCE, 0xEA, 0x7B, 0x4D, 0x44, 0x1A, 0x5B, 0xA4, 0x06, 0x1D, 0x30, 0xB2, 0x56, 0x20, 0x1B,
+  0x63, 0x95, 0xDE, 0xF5, 0x10, 0xC5, 0x1A, 0xF5, 0x12, 0x65, 0x6B, 0x89, 0x8D, 0x2D, 0x59, 0xEB,
+  0x47, 0x6E, 0x90, 0xC6, 0xC4, 0x9C, 0x47, 0x57, 0x62, 0x64, 0x44, 0xE5, 0xEE, 0x90, 0xD5, 0x0D,
+  0x2A, 0xEA, 0x45, 0x05, 0xC1, 0xB9, 0x90, 0x85, 0x68, 0x75, 0x14, 0x81, 0xAA, 0xE3, 0xAB, 0x2D,
+  0x80, 0x68, 0x7F, 0x84, 0x12, 0xE5, 0x4E, 0x60, 0xCF, 0x5D, 0xCE, 0x7D, 0x80, 0xF2, 0xDA, 0x0F,
+  0x87, 0xB6, 0x7D, 0xB5, 0x9B, 0x29, 0x71, 0x69, 0xD7, 0xF2, 0x5F, 0x7F, 0xDA, 0xB5, 0xEC, 0x47,
+  0xEE, 0x9A, 0xFC, 0xB5, 0xFE, 0x7F, 0x4B, 0x74, 0x9C, 0x70, 0xC5, 0x17, 0x00, 0x00,
+};
+
+// screen.html: 884 bytes
+static const uint8_t webScreenHtml[] PROGMEM =
+{
+  0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x85, 0x55, 0x6D, 0x6F, 0x9B, 0x48,
+  0x10, 0xFE, 0xCE, 0xAF, 0x98, 0xFB, 0xD0, 0x2E, 0x9C, 0x5F, 0xC0, 0x38, 0x6D, 0x72, 0xE1, 0x45,
+  0xA2, 0x36, 0xA9, 0xAD, 0xDA, 0x4E, 0x64, 0xD3, 0xAB, 0xA2, 0x28, 0x1F, 0x30, 0xAC, 0x6D, 0x74,
+  0x18, 0x10, 0xBB, 0x36, 0xB6, 0xDA, 0xFC, 0xF7, 0x9B, 0x5D, 0xA0, 0x69, 0x2E, 0x51, 0x4F, 0x96,
+  0xB5, 0xB3, 0xB3, 0xF3, 0x3C, 0xF3, 0xCC, 0xCC, 0x02, 0xF6, 0x1F, 0xE3, 0xDB, 0x51, 0x70, 0x7F,
+  0xE7, 0xC3, 0x24, 0x98, 0xCF, 0x5C, 0xC5, 0x6E, 0x17, 0xDF, 0x1B, 0xE3, 0x32, 0xF7, 0x03, 0x0F,
+  0x46, 0x13, 0x6F, 0xB9, 0xF2, 0x03, 0x87, 0x7C, 0x0D, 0x6E, 0x7A, 0x57, 0xA4, 0x75, 0x2F, 0xBC,
+  0xB9, 0xEF, 0x90, 0x63, 0x42, 0xAB, 0x22, 0x2F, 0x39, 0x81, 0xD1, 0xED, 0x22, 0xF0, 0x17, 0x18,
+  0x56, 0x25, 0x31, 0xDF, 0x39, 0x31, 0x3D, 0x26, 0x11, 0xED, 0xC9, 0x4D, 0x17, 0x92, 0x2C, 0xE1,
+  0x49, 0x98, 0xF6, 0x58, 0x14, 0xA6, 0xD4, 0x19, 0xF4, 0x0D, 0x41, 0x13, 0x4C, 0x83, 0x99, 0xEF,
+  0x7A, 0xC1, 0xAA, 0x37, 0xC7, 0x73, 0x58, 0x45, 0x25, 0xA5, 0x99, 0xAD, 0xD7, 0x6E, 0xC5, 0x9E,
+  0x4D, 0x17, 0x5F, 0x60, 0xE9, 0xCF, 0x1C, 0xC2, 0xF8, 0x39, 0xA5, 0x6C, 0x47, 0x29, 0xA6, 0x99,
+  0x2C, 0xFD, 0x1B, 0x87, 0xE8, 0xD2, 0xD5, 0x8F, 0x18, 0x13, 0x44, 0x7A, 0x23, 0xF7, 0xD3, 0xED,
+  0xF8, 0x5E, 0x88, 0x1F, 0xBC, 0x26, 0x45, 0x9F, 0x62, 0xDF, 0x81, 0x37, 0x9B, 0x7E, 0x5E, 0x38,
+  0x64, 0x84, 0x42, 0xFD, 0xA5, 0x80, 0x7A, 0x2D, 0x21, 0x71, 0x57, 0x3C, 0xE4, 0x07, 0x66, 0xEB,
+  0x9E, 0xAB, 0xBC, 0xCF, 0xD6, 0xAC, 0xB0, 0x7E, 0xD4, 0xCB, 0x73, 0xCC, 0x9E, 0xEE, 0xF3, 0xF2,
+  0x4C, 0xDC, 0xB9, 0x5C, 0x7F, 0x17, 0x19, 0xE5, 0x19, 0xCB, 0x53, 0x4A, 0xDC, 0x51, 0x6D, 0xFC,
+  0x2E, 0x96, 0x45, 0x79, 0x81, 0x91, 0x2B, 0xB1, 0xFC, 0x0F, 0xE7, 0x26, 0xD9, 0x4A, 0x4A, 0x5C,
+  0x65, 0xA4, 0xAD, 0xDF, 0xBD, 0x5D, 0xD6, 0xC8, 0x5B, 0xFC, 0xED, 0xAD, 0x60, 0x3A, 0xC6, 0xE6,
+  0xC9, 0x0E, 0x10, 0xF8, 0x36, 0x1D, 0x07, 0x13, 0x87, 0x0C, 0x4D, 0x03, 0x9B, 0xE8, 0x4F, 0x3F,
+  0x4F, 0x70, 0x54, 0x83, 0x4B, 0xDC, 0xAC, 0x82, 0xFB, 0x99, 0xDF, 0x8C, 0xED, 0x1A, 0x06, 0x86,
+  0xF1, 0xCE, 0x82, 0x7D, 0x78, 0xEA, 0x35, 0x8E, 0x8F, 0x17, 0x46, 0x71, 0xB2, 0x20, 0xD9, 0x87,
+  0x5B, 0xDA, 0x2B, 0x69, 0x16, 0xD3, 0x32, 0xC9, 0xB6, 0xD7, 0x50, 0x24, 0x27, 0x9A, 0x86, 0x9C,
+  0xC6, 0x16, 0x71, 0x6D, 0xBD, 0x4E, 0xD8, 0x2A, 0x5A, 0x8D, 0x96, 0xD3, 0xBB, 0xC0, 0x55, 0x8E,
+  0x61, 0x09, 0x11, 0x3F, 0x81, 0x03, 0x71, 0x1E, 0x1D, 0xF6, 0x34, 0xE3, 0xFD, 0x2D, 0xE5, 0x7E,
+  0x4A, 0x85, 0xF9, 0xE9, 0x3C, 0x8D, 0xD5, 0x56, 0x9E, 0x26, 0x0E, 0xB0, 0x32, 0x4E, 0x4F, 0x5C,
+  0x25, 0x66, 0x4C, 0x34, 0x4B, 0xD9, 0x1C, 0xB2, 0x88, 0x27, 0x79, 0x06, 0xE5, 0x76, 0xAD, 0xC6,
+  0x5D, 0x28, 0xBA, 0x90, 0xE3, 0x55, 0xDA, 0x6F, 0x35, 0xE5, 0xBB, 0xA4, 0x3E, 0x22, 0xB1, 0x1A,
+  0x3F, 0x14, 0x8F, 0x60, 0xDB, 0x70, 0xA5, 0xC1, 0x0F, 0xC0, 0x0D, 0x74, 0x60, 0xF0, 0x68, 0x29,
+  0x18, 0xD6, 0x8F, 0x43, 0x1E, 0x3E, 0xE4, 0x8F, 0x22, 0x4A, 0x3D, 0x82, 0xEB, 0x8A, 0x98, 0xF7,
+  0x60, 0x9C, 0x6E, 0x64, 0x6C, 0xED, 0x1A, 0x0C, 0xB5, 0x5F, 0x83, 0x25, 0xFA, 0x19, 0x30, 0x6C,
+  0x00, 0x23, 0x09, 0xA8, 0x7D, 0x7F, 0x09, 0xDF, 0x2B, 0x94, 0xD9, 0xA2, 0x50, 0xCA, 0xF0, 0x45,
+  0x9A, 0x1A, 0x65, 0x0A, 0xDF, 0xE5, 0x7F, 0x51, 0x43, 0x81, 0x32, 0x3F, 0x7C, 0xB0, 0x94, 0xA7,
+  0xE7, 0x72, 0xE3, 0x32, 0xAC, 0xD4, 0xB8, 0x2D, 0xB2, 0x6E, 0xDF, 0x83, 0xF1, 0xD8, 0x05, 0x5E,
+  0x49, 0xD3, 0x14, 0xE6, 0x4E, 0x9A, 0x43, 0x34, 0x0B, 0xB4, 0x2E, 0x2C, 0xA5, 0xDA, 0x25, 0x29,
+  0x55, 0x0B, 0xB0, 0x21, 0xEE, 0xA7, 0x34, 0xDB, 0xF2, 0xDD, 0x4F, 0x06, 0x19, 0x5A, 0x60, 0x28,
+  0x4E, 0x0F, 0x6D, 0xD1, 0xA2, 0x21, 0xFE, 0xD5, 0xB6, 0x5B, 0x42, 0x65, 0x6D, 0x9B, 0x4D, 0x2B,
+  0x35, 0x6C, 0x35, 0x46, 0x1A, 0x96, 0x24, 0x40, 0xC9, 0xB8, 0xC1, 0x41, 0xF6, 0x71, 0x58, 0x38,
+  0xF2, 0xA9, 0xB8, 0x0B, 0x63, 0xAC, 0x41, 0xE5, 0x95, 0x90, 0x22, 0x66, 0x95, 0x97, 0x98, 0xBB,
+  0xE3, 0x20, 0xB1, 0x05, 0x42, 0x84, 0x48, 0x65, 0x41, 0x2B, 0xA1, 0x56, 0x5B, 0x74, 0x3A, 0x62,
+  0x32, 0x1B, 0x75, 0x27, 0xFB, 0x73, 0x65, 0x88, 0x63, 0x81, 0x94, 0x49, 0x44, 0x3E, 0x84, 0x24,
+  0x08, 0x6E, 0x02, 0x2E, 0x6F, 0x34, 0xA1, 0x49, 0x38, 0x3B, 0x1D, 0xA1, 0x08, 0xF9, 0x2F, 0xB4,
+  0xD7, 0xD7, 0xC1, 0x52, 0x64, 0x6A, 0x53, 0x74, 0x91, 0xA6, 0x8C, 0xBE, 0xCD, 0xEA, 0xA0, 0x8A,
+  0x17, 0x4C, 0xA2, 0x75, 0x02, 0xF6, 0x26, 0xE3, 0x13, 0xFE, 0x44, 0xC5, 0xC5, 0x81, 0x3F, 0x97,
+  0x8B, 0x47, 0x5D, 0x50, 0x39, 0xBC, 0xC3, 0xA9, 0x68, 0xF0, 0x27, 0x88, 0xF2, 0xE7, 0x21, 0xDF,
+  0xF5, 0x37, 0x69, 0x8E, 0x09, 0x39, 0xE8, 0xED, 0xC1, 0xAE, 0xA1, 0xF8, 0x39, 0x54, 0x7C, 0x7A,
+  0x33, 0x1A, 0x71, 0xB5, 0xED, 0x48, 0xC5, 0x50, 0x59, 0x46, 0x2B, 0xF8, 0x46, 0xD7, 0xAB, 0x3C,
+  0xFA, 0x87, 0xE2, 0xB5, 0xAF, 0xD8, 0xB5, 0xAE, 0x13, 0x2C, 0x39, 0xCD, 0xA3, 0x50, 0xA0, 0xFA,
+  0xBB, 0x9C, 0x71, 0xDC, 0x13, 0xBD, 0x62, 0x7A, 0xFB, 0xA4, 0xE0, 0xA8, 0x59, 0x7F, 0x9D, 0x64,
+  0x61, 0x79, 0x0E, 0xCE, 0x05, 0x45, 0x1A, 0x12, 0x96, 0x65, 0x78, 0x5E, 0x1F, 0x36, 0x1B, 0x5A,
+  0x12, 0x79, 0x9C, 0x67, 0x7B, 0xCA, 0x18, 0xCA, 0xC6, 0xD3, 0x56, 0x82, 0x4A, 0x35, 0xF8, 0x5E,
+  0x5F, 0x2E, 0x91, 0xF7, 0x6B, 0x92, 0xF1, 0x2B, 0x4F, 0x00, 0x55, 0x2A, 0x2F, 0xA4, 0xA6, 0x59,
+  0xF0, 0xD4, 0xA0, 0xA3, 0x34, 0x67, 0x2F, 0xB0, 0x02, 0xCA, 0x28, 0x0F, 0x92, 0x3D, 0xCD, 0x0F,
+  0x5C, 0x6D, 0xAA, 0xE9, 0x82, 0x69, 0x18, 0x46, 0x8D, 0xC3, 0x76, 0xB5, 0x25, 0x5A, 0xF8, 0x1A,
+  0x68, 0x5F, 0x01, 0xB6, 0xDE, 0xBC, 0x95, 0xF5, 0xFA, 0xD3, 0xF2, 0x2F, 0xC6, 0x98, 0x1E, 0x80,
+  0x72, 0x06, 0x00, 0x00,
+};
+
+// status.js: 446 bytes
+static const uint8_t webStatusJs[] PROGMEM =
+{
+  0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x75, 0x52, 0xC1, 0x6E, 0xDB, 0x30,
+  0x0C, 0xBD, 0xFB, 0x2B, 0x78, 0xB3, 0x8C, 0x06, 0xF6, 0xD6, 0x63, 0x8D, 0xA2, 0x40, 0x87, 0x15,
+  0x6B, 0xB1, 0x6E, 0x87, 0x0E, 0xDB, 0xA1, 0xE8, 0x41, 0x91, 0xE8, 0x58, 0x88, 0x23, 0x65, 0x22,
+  0x6D, 0x37, 0x0B, 0xF2, 0xEF, 0x93, 0x14, 0xC7, 0xCD, 0x0A, 0xCC, 0x3E, 0x58, 0x24, 0xDF, 0x7B,
+  0x7C, 0x26, 0x55, 0x55, 0xF0, 0xD5, 0x0C, 0x08, 0x83, 0xEC, 0x7A, 0x24, 0x70, 0x0D, 0x70, 0x8B,
+  0x40, 0x2C, 0xB9, 0x27, 0xD8, 0xCA, 0x15, 0x2E, 0x52, 0xC2, 0xA3, 0xC2, 0x00, 0xF3, 0x40, 0x68,
+  0x35, 0x81, 0xEC, 0xBA, 0x89, 0x91, 0x55, 0x15, 0x34, 0xC6, 0x13, 0x27, 0x9C, 0x05, 0x67, 0xBB,
+  0x5D, 0x62, 0x4C, 0x82, 0xDC, 0x4A, 0x06, 0xD5, 0x4A, 0xBB, 0xC2, 0x6C, 0x90, 0x1E, 0xBC, 0xD4,
+  0xC6, 0xC1, 0x35, 0xEC, 0x0F, 0x75, 0xD6, 0xF4, 0x56, 0xB1, 0x71, 0x16, 0xA8, 0x75, 0xA3, 0x30,
+  0x3A, 0x48, 0xE0, 0x2B, 0x17, 0xD9, 0x3E, 0x21, 0x31, 0xA0, 0xB4, 0x53, 0xFD, 0x06, 0x2D, 0x97,
+  0x2B, 0xE4, 0xCF, 0x1D, 0xC6, 0xE3, 0xED, 0xEE, 0x5E, 0x07, 0x6C, 0x51, 0x67, 0xA6, 0x11, 0x58,
+  0x00, 0x96, 0x91, 0xF4, 0xC9, 0x59, 0x0E, 0xC5, 0x40, 0x89, 0x51, 0x9D, 0x1D, 0xDE, 0xC4, 0xFB,
+  0xAD, 0x96, 0x8C, 0x62, 0x88, 0xBA, 0x8D, 0xF3, 0x22, 0x6A, 0xAF, 0xC1, 0x58, 0x18, 0x8A, 0xA3,
+  0x9B, 0xE7, 0xF5, 0x4B, 0xE0, 0x0D, 0xE1, 0x53, 0xA7, 0xC6, 0x8D, 0xC7, 0xDF, 0x21, 0x91, 0x6A,
+  0xE5, 0xC6, 0xE9, 0x60, 0xE4, 0x1A, 0xF2, 0xBB, 0xC7, 0x1C, 0x6E, 0x40, 0x1C, 0xB3, 0x11, 0xD2,
+  0xA3, 0x55, 0x3B, 0xA8, 0xE0, 0xE3, 0x87, 0xF4, 0x14, 0x25, 0xBB, 0x3B, 0xF3, 0x8A, 0x5A, 0x5C,
+  0x16, 0x70, 0x01, 0xF9, 0xE3, 0x97, 0x3F, 0x39, 0x5C, 0xFD, 0x8F, 0xF0, 0x1E, 0xBD, 0x0E, 0xE8,
+  0x3A, 0x4B, 0x73, 0xC8, 0x97, 0xD2, 0xEA, 0x7C, 0x31, 0xF5, 0x8F, 0x41, 0x71, 0xAA, 0x44, 0x95,
+  0x50, 0x49, 0x06, 0x03, 0x29, 0xBC, 0x17, 0x67, 0x36, 0x67, 0x98, 0x27, 0x32, 0xB3, 0x40, 0x0C,
+  0x22, 0x58, 0xDF, 0xF6, 0x3F, 0xF3, 0x19, 0x42, 0xD6, 0xCF, 0x88, 0x70, 0x3E, 0x02, 0xDE, 0xCA,
+  0x4B, 0xC9, 0x8C, 0x7E, 0x77, 0xE6, 0x22, 0xC5, 0xEF, 0x4C, 0x27, 0xBD, 0xB3, 0x49, 0x2B, 0x67,
+  0x2D, 0x2A, 0x16, 0xA7, 0x0D, 0x8E, 0x14, 0xC6, 0x68, 0x71, 0x84, 0x5F, 0xB8, 0x7C, 0x72, 0x6A,
+  0x8D, 0x2C, 0xF2, 0x91, 0xAE, 0xAA, 0x2A, 0xFA, 0xEE, 0x9C, 0x92, 0x91, 0x55, 0xB6, 0x8E, 0x38,
+  0xAA, 0x55, 0x23, 0x55, 0xC7, 0x7B, 0x17, 0x65, 0x47, 0x2A, 0x9D, 0xDD, 0x20, 0x51, 0xB8, 0x82,
+  0x41, 0xE5, 0xD4, 0x23, 0x6E, 0x7C, 0x7F, 0x5A, 0xE9, 0xC3, 0xD3, 0xF7, 0x6F, 0xE5, 0x56, 0x7A,
+  0x42, 0x81, 0x65, 0xC8, 0xC8, 0xA2, 0xA8, 0xE1, 0x30, 0x71, 0x55, 0xE7, 0xE8, 0x1F, 0x66, 0x24,
+  0x12, 0xF2, 0x0F, 0xB3, 0x41, 0xD7, 0xB3, 0x98, 0xCC, 0x2E, 0xE0, 0x32, 0xAE, 0x23, 0xF1, 0x0E,
+  0xD9, 0xFC, 0x07, 0x75, 0xF6, 0x17, 0xE4, 0xAA, 0x86, 0xB7, 0x19, 0x03, 0x00, 0x00,
+};
+
+// style.css: 296 bytes
+static const uint8_t webStyleCss[] PROGMEM =
+{
+  0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x75, 0x51, 0x41, 0x4F, 0x83, 0x30,
+  0x18, 0xBD, 0xF7, 0x57, 0x90, 0x98, 0xDD, 0x56, 0xC2, 0x0E, 0xE8, 0xA4, 0xF1, 0x00, 0xA3, 0x93,
+  0x25, 0x04, 0x8D, 0xE2, 0xC1, 0x98, 0x1D, 0x0A, 0x14, 0xD6, 0x08, 0x85, 0xB4, 0x25, 0xDB, 0x62,
+  0xF6, 0xDF, 0xFD, 0xD8, 0xCC, 0x58, 0xD4, 0xDD, 0xFA, 0xBD, 0x97, 0xF7, 0xBD, 0xF7, 0xFA, 0x05,
+  0x4F, 0xE1, 0x3B, 0xFA, 0x42, 0x0D, 0x53, 0x95, 0x90, 0x9E, 0xE5, 0x10, 0xD4, 0xB1, 0xA2, 0x10,
+  0xB2, 0x3A, 0xBE, 0xCB, 0x56, 0x1A, 0x5C, 0xB2, 0x46, 0xD4, 0x7B, 0xCF, 0xD2, 0x4C, 0x6A, 0xAC,
+  0xB9, 0x12, 0x25, 0x41, 0x07, 0x14, 0xCD, 0x40, 0x66, 0xF8, 0xCE, 0x60, 0x56, 0x8B, 0x0A, 0xA4,
+  0x39, 0x97, 0x86, 0xAB, 0x81, 0x4A, 0xFD, 0x20, 0xA6, 0xC0, 0x6E, 0x45, 0x61, 0x36, 0x9E, 0x35,
+  0x73, 0x9C, 0x09, 0x01, 0x87, 0x1D, 0xFE, 0x01, 0xEE, 0x6E, 0xE7, 0xDD, 0x8E, 0xA0, 0xAC, 0x55,
+  0x05, 0x57, 0xE0, 0x33, 0x0C, 0xA7, 0x00, 0xB8, 0xE6, 0xA5, 0xF1, 0x2C, 0xD6, 0x9B, 0xF6, 0x0C,
+  0x29, 0x51, 0x6D, 0xCE, 0x18, 0x2C, 0x8F, 0xA6, 0x56, 0x1A, 0xC2, 0xF6, 0x31, 0xA7, 0xED, 0xF2,
+  0xE6, 0x44, 0xD9, 0x11, 0xF5, 0xC3, 0x55, 0xF2, 0x08, 0x74, 0xC6, 0xF2, 0xCF, 0x4A, 0xB5, 0xBD,
+  0x2C, 0x70, 0xDE, 0xD6, 0x2D, 0xF8, 0xDC, 0xCC, 0x1D, 0xDF, 0x59, 0x2E, 0x09, 0x82, 0xB9, 0x6F,
+  0x24, 0xD6, 0x1D, 0x83, 0xD8, 0xAC, 0xAE, 0xC9, 0xB5, 0x1E, 0xA1, 0x1D, 0xFB, 0x01, 0x8D, 0x7F,
+  0x15, 0x3D, 0x06, 0x1A, 0xF8, 0x55, 0xF2, 0xFC, 0x96, 0x7E, 0x98, 0x7D, 0xC7, 0x1F, 0x06, 0x7E,
+  0x3D, 0xB5, 0x2E, 0x90, 0x8E, 0x69, 0xBD, 0x85, 0x86, 0x80, 0xBE, 0xD2, 0x98, 0x2E, 0xD2, 0xF1,
+  0x43, 0xEE, 0xDD, 0x09, 0xF9, 0x27, 0xFE, 0x85, 0x58, 0xF7, 0x59, 0x23, 0xCC, 0x7A, 0x94, 0xB8,
+  0xCE, 0x1F, 0xC9, 0x70, 0x9F, 0x03, 0xB2, 0x17, 0x34, 0x49, 0xE9, 0xCB, 0xD5, 0x5B, 0x7C, 0x03,
+  0x6F, 0x25, 0x34, 0x00, 0xE0, 0x01, 0x00, 0x00,
+};
+
+// update.html: 1706 bytes
+static const uint8_t webUpdateHtml[] PROGMEM =
+{
+  0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x85, 0x57, 0x6D, 0x73, 0xE2, 0x46,
+  0x0C, 0xFE, 0xCE, 0xAF, 0x50, 0x3F, 0xB4, 0xB6, 0x1B, 0xB0, 0xB1, 0x03, 0x79, 0x39, 0x5E, 0x3A,
+  0x04, 0x9C, 0x86, 0x39, 0x48, 0x18, 0x70, 0x3A, 0xBD, 0xC9, 0xA4, 0x33, 0x8B, 0xBD, 0x06, 0xF7,
+  0xC0, 0x76, 0xED, 0x25, 0x90, 0xB9, 0xCB, 0xFD, 0xF6, 0x4A, 0xBB, 0xB6, 0x49, 0xEE, 0xAE, 0x57,
+  0x66, 0x60, 0x77, 0xB5, 0x92, 0x56, 0x7A, 0xA4, 0x95, 0x96, 0xEE, 0x4F, 0xA3, 0xBB, 0xA1, 0xF7,
+  0x61, 0xE6, 0xC2, 0x8D, 0x37, 0x9D, 0xF4, 0x6B, 0xDD, 0x72, 0x70, 0x07, 0x23, 0x1C, 0xA6, 0xAE,
+  0x37, 0x80, 0xE1, 0xCD, 0x60, 0xBE, 0x70, 0xBD, 0x9E, 0x76, 0xEF, 0x5D, 0x37, 0x2E, 0xB4, 0x92,
+  0x7C, 0x3B, 0x98, 0xBA, 0x3D, 0xED, 0x29, 0xE2, 0xFB, 0x34, 0xC9, 0x84, 0x06, 0xC3, 0xBB, 0x5B,
+  0xCF, 0xBD, 0x45, 0xB6, 0x7D, 0x14, 0x88, 0x75, 0x2F, 0xE0, 0x4F, 0x91, 0xCF, 0x1B, 0x72, 0x51,
+  0x87, 0x28, 0x8E, 0x44, 0xC4, 0x36, 0x8D, 0xDC, 0x67, 0x1B, 0xDE, 0xB3, 0xCD, 0x26, 0xA9, 0xF1,
+  0xC6, 0xDE, 0xC4, 0xED, 0x0F, 0xBC, 0x45, 0x63, 0x8A, 0xFB, 0x70, 0x1D, 0x65, 0xDB, 0x3D, 0xCB,
+  0x38, 0xDC, 0xA7, 0x01, 0x13, 0xBC, 0x6B, 0xA9, 0xFD, 0x5A, 0x77, 0x32, 0xBE, 0x7D, 0x0F, 0x73,
+  0x77, 0xD2, 0xD3, 0x72, 0xF1, 0xBC, 0xE1, 0xF9, 0x9A, 0x73, 0x3C, 0xEF, 0x66, 0xEE, 0x5E, 0xF7,
+  0x34, 0x4B, 0x92, 0x4C, 0x3F, 0xCF, 0x49, 0xA3, 0x55, 0xD8, 0x7D, 0x75, 0x37, 0xFA, 0x40, 0x5E,
+  0xD8, 0x3F, 0xD0, 0x8E, 0x9B, 0xB5, 0xEE, 0x0C, 0x06, 0x93, 0xF1, 0xEF, 0xB7, 0x3D, 0x6D, 0x88,
+  0xA6, 0xBB, 0x73, 0xD2, 0x31, 0x28, 0x35, 0x6B, 0xFD, 0x85, 0x60, 0x62, 0x97, 0x77, 0xAD, 0x41,
+  0xBF, 0xF6, 0x4B, 0xBC, 0xCC, 0xD3, 0xCE, 0x67, 0x35, 0x1C, 0x79, 0xB6, 0x7C, 0x9B, 0x64, 0xCF,
+  0x5A, 0x7F, 0x2A, 0xC7, 0x1F, 0x71, 0xFA, 0x49, 0x1C, 0x46, 0x2B, 0xAD, 0x3F, 0x94, 0xA3, 0xE4,
+  0xEC, 0x5A, 0x33, 0xFC, 0xB9, 0xBE, 0x9B, 0x4F, 0xE1, 0xEE, 0x76, 0x71, 0x7F, 0x35, 0x1D, 0x23,
+  0x7A, 0xBB, 0x74, 0x93, 0xB0, 0x40, 0x37, 0x3A, 0x90, 0x71, 0xB1, 0xCB, 0x62, 0x08, 0xD9, 0x26,
+  0xE7, 0x1D, 0xC4, 0x77, 0x32, 0x58, 0x2C, 0x5E, 0x1B, 0x3A, 0xEB, 0x2F, 0xF8, 0x86, 0xFB, 0x02,
+  0xC4, 0x9A, 0x43, 0x77, 0x78, 0x37, 0x72, 0xFB, 0x4C, 0xE4, 0x8D, 0x2D, 0x7A, 0x6B, 0x46, 0x71,
+  0x62, 0x2E, 0xA3, 0xB8, 0x6B, 0x49, 0x32, 0x84, 0xA5, 0xF3, 0x61, 0xB4, 0xE1, 0xA0, 0xC7, 0x89,
+  0x12, 0xDA, 0xF2, 0x6C, 0xC5, 0x03, 0x48, 0x62, 0x6E, 0x28, 0x5B, 0x66, 0xFD, 0xEE, 0xF8, 0x76,
+  0x76, 0xEF, 0xC1, 0x78, 0xD4, 0xD3, 0x88, 0x57, 0x03, 0x4A, 0x8E, 0x9E, 0x76, 0x3D, 0x9E, 0xB8,
+  0x1A, 0x0C, 0x86, 0x43, 0x77, 0x86, 0x36, 0x92, 0x6A, 0xAD, 0x0F, 0x05, 0xAF, 0xE2, 0x50, 0xF6,
+  0x6B, 0xF0, 0xC7, 0x60, 0x72, 0x8F, 0x4B, 0x85, 0xB2, 0xD6, 0xAF, 0xF4, 0xCE, 0xE6, 0x77, 0xBF,
+  0xCF, 0xDD, 0xC5, 0x42, 0xAA, 0x4E, 0xB3, 0x64, 0x95, 0x71, 0x8C, 0x19, 0x4C, 0x07, 0x7F, 0xF6,
+  0x34, 0xBB, 0xD9, 0xAC, 0x04, 0x71, 0xB6, 0xF0, 0x3E, 0x4C, 0xDC, 0x22, 0x8F, 0xDE, 0x41, 0xBB,
+  0xF9, 0x73, 0x47, 0xEA, 0x29, 0x14, 0x14, 0x2A, 0x2D, 0xC2, 0x4D, 0x46, 0x90, 0x14, 0xE6, 0x32,
+  0x52, 0xDA, 0xD7, 0xD1, 0xF4, 0xD0, 0xC9, 0x8C, 0xFB, 0x3C, 0x7A, 0xE2, 0x19, 0x7C, 0xE4, 0x3C,
+  0xCD, 0x61, 0x9F, 0x64, 0x1F, 0xA3, 0x78, 0x05, 0xC1, 0x2E, 0xA3, 0x81, 0x60, 0x50, 0x90, 0x03,
+  0x8B, 0x03, 0x64, 0x5E, 0x26, 0x89, 0x40, 0xAE, 0x35, 0x8F, 0x21, 0x12, 0x10, 0xE5, 0x10, 0x20,
+  0x3C, 0xEA, 0xC8, 0xC5, 0x70, 0x3E, 0x9E, 0x79, 0xFD, 0x5A, 0xB8, 0x8B, 0x7D, 0x11, 0x25, 0x31,
+  0xA8, 0x53, 0xF5, 0xDC, 0x80, 0x4F, 0xC8, 0xE6, 0xEF, 0xB6, 0x3C, 0x16, 0xE6, 0x8A, 0x0B, 0x77,
+  0xC3, 0x69, 0x7A, 0xF5, 0x3C, 0x0E, 0xF4, 0xD2, 0x34, 0xC3, 0x14, 0xFC, 0x20, 0x30, 0xFA, 0x02,
+  0x77, 0xA0, 0x07, 0x79, 0x07, 0x5E, 0x8E, 0x9A, 0xB6, 0x41, 0x5B, 0x0F, 0x8C, 0xDA, 0xA7, 0xDA,
+  0x13, 0xCB, 0xE0, 0x3D, 0x6E, 0x3F, 0x3C, 0xD6, 0x61, 0x41, 0xE3, 0x79, 0x1D, 0x6C, 0x07, 0xBF,
+  0x38, 0x3A, 0x38, 0xB6, 0xEB, 0x70, 0x89, 0xAB, 0x16, 0xAE, 0x9A, 0x75, 0xC0, 0xC1, 0xB6, 0xF1,
+  0x7B, 0x86, 0xCB, 0xD3, 0x3A, 0xE0, 0x60, 0x23, 0xD5, 0x46, 0x26, 0xC7, 0x7E, 0xEC, 0xD4, 0xC2,
+  0x24, 0xD3, 0x49, 0x61, 0x84, 0x8A, 0x9A, 0xD0, 0xC1, 0xB1, 0x0B, 0x67, 0x2D, 0x9A, 0x9C, 0x9C,
+  0x18, 0xF0, 0xFE, 0x21, 0x7A, 0xC4, 0x8D, 0x29, 0x13, 0x6B, 0x33, 0xDC, 0x24, 0xC8, 0x2B, 0xA7,
+  0x6C, 0x99, 0xAB, 0x49, 0x1E, 0xC5, 0x7A, 0x04, 0x27, 0x60, 0x1B, 0x06, 0xFC, 0x0A, 0x2D, 0xE7,
+  0xB2, 0x75, 0x79, 0x76, 0xEE, 0x5C, 0x9E, 0x19, 0xF0, 0x19, 0x9A, 0x1D, 0x69, 0x69, 0x8C, 0xF2,
+  0xBA, 0x1E, 0x98, 0x1B, 0x1E, 0xAF, 0xC4, 0x1A, 0x79, 0x2F, 0x0C, 0xE8, 0xF7, 0x01, 0x59, 0x50,
+  0xAC, 0x0E, 0x7B, 0xDC, 0x8E, 0xF9, 0x1E, 0xC6, 0xB1, 0x38, 0x75, 0x06, 0x59, 0xC6, 0x9E, 0xF5,
+  0x18, 0x55, 0xD9, 0x67, 0xC6, 0xF7, 0x6D, 0xAB, 0x14, 0x15, 0x16, 0xEE, 0x1F, 0x22, 0x52, 0xE7,
+  0x3C, 0xC2, 0xE7, 0x1E, 0x04, 0x64, 0x6E, 0xB7, 0x8B, 0xE7, 0x45, 0xF0, 0x33, 0xB4, 0xC8, 0xA6,
+  0x0B, 0xD4, 0xB3, 0x7F, 0xA8, 0xA4, 0x2A, 0xD6, 0xE6, 0xE1, 0xA2, 0xA9, 0x58, 0xAB, 0xBD, 0x37,
+  0x12, 0xCA, 0x08, 0x68, 0x10, 0x7B, 0xEF, 0x78, 0x2A, 0x6E, 0xBF, 0xD9, 0xB5, 0xBF, 0x82, 0xA7,
+  0x62, 0xB4, 0xF0, 0x04, 0xA7, 0xA9, 0x3E, 0x86, 0x42, 0x62, 0x4D, 0xB1, 0x6A, 0x1E, 0xCE, 0xCE,
+  0x5B, 0x6D, 0xE7, 0xB4, 0x89, 0xBE, 0x37, 0x0F, 0xEE, 0xF5, 0x70, 0x34, 0xB8, 0xBA, 0xB8, 0x24,
+  0xB8, 0x68, 0x7D, 0x79, 0x71, 0x35, 0x18, 0x0D, 0xAF, 0xDD, 0x72, 0x6D, 0x37, 0x4F, 0x9D, 0x76,
+  0xEB, 0xFC, 0xEC, 0x55, 0xA0, 0x92, 0x02, 0x8C, 0x04, 0xC1, 0xD8, 0x1F, 0xC1, 0x48, 0xE0, 0xA4,
+  0x47, 0xA8, 0x15, 0xF9, 0xC1, 0x90, 0x6B, 0xFD, 0xD0, 0xC4, 0x0C, 0x59, 0xCA, 0x99, 0x8D, 0x33,
+  0x5F, 0xCE, 0x1C, 0x9C, 0x71, 0x39, 0x3B, 0xFD, 0xBF, 0xF0, 0x17, 0xBA, 0xC2, 0x3A, 0xAC, 0xEA,
+  0x90, 0x21, 0x87, 0x84, 0xBA, 0xD5, 0xA9, 0x45, 0xA1, 0x8E, 0x4B, 0x94, 0xA0, 0xAC, 0x0E, 0x29,
+  0xC0, 0x4B, 0xF8, 0x05, 0x7C, 0x8A, 0xBA, 0xFE, 0x85, 0xA6, 0x1C, 0x6B, 0xD3, 0x8A, 0x04, 0x28,
+  0x83, 0x39, 0x16, 0x27, 0x28, 0x45, 0xEC, 0x4A, 0x84, 0x23, 0xDF, 0x52, 0x89, 0x70, 0x29, 0xAD,
+  0x44, 0xF4, 0x36, 0x62, 0xAB, 0x72, 0x0A, 0x23, 0x62, 0x9F, 0x7D, 0xA3, 0xC1, 0x29, 0x35, 0x2C,
+  0xE1, 0x2F, 0xF4, 0xE9, 0x2F, 0xE0, 0x85, 0xE0, 0x69, 0x21, 0xD8, 0xFE, 0x4A, 0x50, 0x71, 0x13,
+  0x27, 0x9A, 0xF9, 0x19, 0xBE, 0x94, 0xC6, 0xE9, 0xE7, 0x24, 0x70, 0x64, 0x26, 0x5F, 0xE9, 0xDA,
+  0xE9, 0x0C, 0x95, 0x84, 0xF8, 0x95, 0xD9, 0x7F, 0x82, 0x29, 0x86, 0xE0, 0xC2, 0xEA, 0xD1, 0x50,
+  0x51, 0xC9, 0x91, 0x65, 0xF1, 0x90, 0x51, 0xBE, 0x23, 0x59, 0x26, 0x1A, 0x02, 0x49, 0x80, 0xA3,
+  0x21, 0x84, 0xAC, 0xDF, 0x91, 0x50, 0x2F, 0x3B, 0xB5, 0xA5, 0x82, 0xE6, 0x04, 0xB3, 0x4C, 0x50,
+  0xB2, 0xE5, 0xD2, 0x5D, 0x81, 0x28, 0xF6, 0xD1, 0x5C, 0x07, 0xF3, 0x27, 0x37, 0xF0, 0xA3, 0x2E,
+  0xCB, 0x4B, 0x8D, 0x02, 0x46, 0x12, 0x72, 0x3C, 0x01, 0xA6, 0x36, 0x64, 0xF4, 0x14, 0xD9, 0x26,
+  0xF2, 0xB2, 0x22, 0x3B, 0x05, 0xD9, 0x21, 0xB2, 0x5F, 0x91, 0x4F, 0x0B, 0xF2, 0x29, 0x91, 0x79,
+  0xA5, 0xBD, 0xE8, 0x15, 0x6B, 0x73, 0xCB, 0x52, 0xBD, 0xAC, 0x2A, 0xFA, 0x53, 0x19, 0xE5, 0x03,
+  0x0A, 0x69, 0xDA, 0xF7, 0x33, 0xA2, 0xAA, 0x07, 0x07, 0xCA, 0x32, 0x5D, 0x7F, 0x52, 0x1E, 0x44,
+  0xF2, 0xB6, 0x18, 0x18, 0x3C, 0xA7, 0xDD, 0xC6, 0xE2, 0x95, 0x2C, 0x04, 0x15, 0x4C, 0x1D, 0xD3,
+  0xD0, 0x4C, 0x59, 0x80, 0xAD, 0x31, 0x13, 0x3A, 0x16, 0x24, 0x2C, 0xD8, 0x78, 0x05, 0x8A, 0xF3,
+  0x0F, 0x68, 0x8B, 0x61, 0xFE, 0x9D, 0x60, 0xE5, 0xD0, 0x88, 0xFC, 0x52, 0xB3, 0x2C, 0x98, 0x25,
+  0x9B, 0x8D, 0xAC, 0xB3, 0x55, 0x25, 0xDE, 0xC5, 0x22, 0x52, 0x24, 0xAA, 0x0E, 0x55, 0x73, 0x62,
+  0x71, 0xBE, 0xE7, 0x59, 0x7E, 0xAC, 0x8A, 0x7B, 0x16, 0x09, 0x3D, 0xA7, 0x93, 0xC8, 0x91, 0x90,
+  0x0B, 0x7F, 0xAD, 0x6B, 0x16, 0x4B, 0x23, 0xAB, 0x28, 0xAA, 0x75, 0x8C, 0xBF, 0xCF, 0xFC, 0x35,
+  0x7F, 0x07, 0x5A, 0x9C, 0x34, 0x72, 0x91, 0x64, 0xD8, 0xB2, 0x5E, 0x8C, 0x9A, 0x89, 0xCA, 0xE3,
+  0x23, 0x10, 0x19, 0xA5, 0x55, 0x61, 0x63, 0x66, 0xFE, 0x9D, 0x23, 0x09, 0xF3, 0xE4, 0x5B, 0x3E,
+  0x62, 0x2B, 0x8A, 0xBA, 0x36, 0x2F, 0xAD, 0xC5, 0x1E, 0xB0, 0x64, 0xFE, 0x47, 0x60, 0xA1, 0xC0,
+  0x95, 0x26, 0x23, 0x3E, 0xC2, 0xE6, 0x66, 0xC6, 0xC9, 0x1E, 0x25, 0x1A, 0xA0, 0x2C, 0xC4, 0xAA,
+  0x60, 0x53, 0x3D, 0x40, 0xA8, 0xAE, 0xA3, 0x03, 0x0F, 0x74, 0x9B, 0xAA, 0xA0, 0x06, 0x39, 0x66,
+  0x15, 0xE7, 0xD2, 0x5B, 0xA5, 0x1A, 0x52, 0xB6, 0xE2, 0x5A, 0x71, 0xBE, 0xCF, 0xC8, 0xA9, 0xB7,
+  0x06, 0x70, 0xE1, 0x45, 0x5B, 0x9E, 0xEC, 0xC4, 0x5B, 0xFA, 0x2B, 0x34, 0x50, 0xB6, 0xAE, 0x4E,
+  0x23, 0x2D, 0x84, 0x73, 0x85, 0x59, 0xF9, 0x7E, 0x28, 0xEF, 0x37, 0x35, 0xFC, 0xDE, 0x7F, 0x77,
+  0x27, 0xD9, 0xE4, 0x0D, 0x93, 0x86, 0x1C, 0x33, 0x53, 0x5E, 0xFF, 0x9F, 0x68, 0x65, 0x14, 0x78,
+  0x75, 0x6A, 0x25, 0x20, 0xC3, 0x64, 0x9B, 0xEE, 0x04, 0x35, 0xCD, 0xE9, 0xA8, 0x0D, 0x08, 0xBA,
+  0xFF, 0x31, 0xDF, 0x6D, 0x4D, 0xD3, 0xA4, 0x48, 0x93, 0x88, 0xC9, 0xA8, 0xC4, 0x5F, 0xED, 0xC2,
+  0x90, 0x67, 0xBA, 0xF1, 0x15, 0xB4, 0xCB, 0x5D, 0x58, 0x65, 0xE3, 0x3A, 0x2B, 0x1A, 0xC3, 0x9F,
+  0xD3, 0xC9, 0x8D, 0x10, 0xE9, 0x9C, 0xFF, 0xB3, 0xE3, 0xB9, 0xD0, 0x8D, 0xBA, 0xC2, 0x12, 0x77,
+  0x8F, 0x00, 0x63, 0x95, 0x63, 0xD9, 0x8F, 0x5C, 0xA8, 0x1E, 0x13, 0x68, 0x06, 0xAA, 0x36, 0x93,
+  0x14, 0xCF, 0xD5, 0x66, 0x77, 0x0B, 0x0F, 0xF3, 0x43, 0xB3, 0x76, 0xF2, 0x25, 0xF2, 0x1B, 0x76,
+  0xD8, 0x1E, 0xC5, 0x8E, 0x3A, 0x2D, 0x1D, 0x7D, 0x1F, 0xC5, 0xE2, 0x42, 0xF5, 0x24, 0x32, 0xCD,
+  0x28, 0x84, 0x11, 0xFC, 0xC2, 0x9A, 0x1B, 0xCE, 0x02, 0xF4, 0x43, 0x2B, 0x5A, 0x76, 0xC3, 0x7B,
+  0x4E, 0x39, 0x29, 0x64, 0x69, 0xBA, 0x89, 0x30, 0x6C, 0xE8, 0x94, 0x95, 0xF8, 0x82, 0x0B, 0x4C,
+  0xBB, 0x8C, 0xB3, 0x6D, 0x79, 0xBC, 0x0A, 0x80, 0x99, 0xC4, 0xA5, 0x5D, 0x68, 0x7B, 0x85, 0x02,
+  0x27, 0x0C, 0xD0, 0x1F, 0xF3, 0x89, 0x6D, 0x76, 0x14, 0x18, 0x6E, 0x12, 0x37, 0x3E, 0xC2, 0x7E,
+  0xA5, 0x78, 0x62, 0x0E, 0x71, 0xCC, 0x1F, 0xC1, 0x36, 0x47, 0xD8, 0xEF, 0xA5, 0x3E, 0x84, 0xFD,
+  0x9D, 0xCC, 0x3D, 0xD9, 0x8F, 0xB2, 0x64, 0x17, 0x07, 0x7A, 0x25, 0x4B, 0x99, 0xE7, 0xB4, 0x54,
+  0xBA, 0x25, 0xE1, 0xB7, 0x6C, 0x52, 0xE3, 0x1B, 0xAE, 0xF7, 0xD1, 0x55, 0x9D, 0xF8, 0x6A, 0xFF,
+  0xA1, 0xCE, 0x44, 0x4E, 0x1C, 0xE5, 0xEE, 0x96, 0x1D, 0xBE, 0x93, 0xEF, 0x75, 0xF9, 0x2E, 0x28,
+  0x74, 0x59, 0x12, 0xFC, 0x97, 0x02, 0xFF, 0x58, 0x3E, 0xA7, 0x5E, 0x79, 0x4D, 0x4E, 0x17, 0xEE,
+  0x10, 0x03, 0x82, 0x92, 0x26, 0x71, 0xCE, 0x3D, 0x7C, 0x10, 0x15, 0xED, 0x93, 0x1E, 0x59, 0x6F,
+  0xA2, 0x2E, 0x13, 0x51, 0x06, 0x44, 0xDD, 0x19, 0xEA, 0x0D, 0x98, 0xEE, 0x3F, 0xBE, 0x1C, 0xA4,
+  0x45, 0xDD, 0x0D, 0x47, 0x75, 0xE6, 0xCA, 0x22, 0x9E, 0x65, 0x49, 0xF6, 0xC6, 0xA4, 0x57, 0x37,
+  0x5D, 0x21, 0x8C, 0x0F, 0x6D, 0xCC, 0xE1, 0x40, 0x5E, 0xCC, 0x32, 0x17, 0x10, 0x15, 0x4A, 0x0E,
+  0xAA, 0x6A, 0x74, 0xC9, 0xBA, 0x56, 0xF9, 0x04, 0xEC, 0x5A, 0xC5, 0x5F, 0x0C, 0x4B, 0xFD, 0x61,
+  0xFA, 0x17, 0x25, 0xEC, 0xE4, 0x45, 0x48, 0x0D, 0x00, 0x00,
+};
+
+static const WebAsset webAssets[] =
+{
+  { "/console", "text/html", webConsoleHtml, sizeof(webConsoleHtml), "\"ef26ab5da94b0ee8\"" },
+  { "/scope", "text/html", webScopeHtml, sizeof(webScopeHtml), "\"b27c5e96b235da18\"" },
+  { "/screen", "text/html", webScreenHtml, sizeof(webScreenHtml), "\"850001d1823d9a42\"" },
+  { "/status.js", "application/javascript", webStatusJs, sizeof(webStatusJs), "\"1b097c8ba36c836e\"" },
+  { "/style.css", "text/css", webStyleCss, sizeof(webStyleCss), "\"3310052606ffc6e8\"" },
+  { "/update", "text/html", webUpdateHtml, sizeof(webUpdateHtml), "\"9ad86b7976a85573\"" },
+};
+
+#endif
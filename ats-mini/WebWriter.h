@@ -0,0 +1,162 @@
+#ifndef WEB_WRITER_H
+#define WEB_WRITER_H
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include <stdarg.h>
+#include <memory>
+
+#define WEB_PAGE_MIN_HEAP 16384  // Largest free heap block needed to serve a page
+
+// Peak heap use while serving a page (bytes)
+extern uint32_t webPageHeap;
+
+// True if the request may change settings (config page login)
+bool webAuthenticate(AsyncWebServerRequest *request);
+
+// Validators of a page that only changes with the receiver state
+typedef struct
+{
+  char etag[24];           // Entity tag
+  char modified[32];       // Last-Modified date, empty if the clock is not set
+} WebCacheTag;
+
+// Fill in validators, true (and 304 sent) if the browser copy is current
+bool webNotModified(AsyncWebServerRequest *request, WebCacheTag *tag);
+
+//
+// Web pages are streamed in chunks written straight into the
+// response buffer. Every chunk renders the page again from the
+// start and keeps only the bytes falling into it, so no page is
+// ever held in memory. Pages are rendered from a snapshot taken
+// when the request arrives, every pass produces the same bytes.
+//
+class WebWriter
+{
+  public:
+    WebWriter(uint8_t *buf, size_t size, size_t index)
+    {
+      this->buf = buf;
+      this->size = size;
+      start = index;
+      pos = 0;
+    }
+
+    void print(const char *text) { write(text, strlen(text)); }
+
+    __attribute__((format(printf, 2, 3)))
+    void printf(const char *format, ...)
+    {
+      char text[128];
+      va_list args;
+
+      va_start(args, format);
+      int len = vsnprintf(text, sizeof(text), format, args);
+      va_end(args);
+
+      if(len > 0) write(text, len < (int)sizeof(text) ? len : sizeof(text) - 1);
+    }
+
+    // Print text inside HTML attributes and elements
+    void printEscaped(const char *text)
+    {
+      for(const char *p = text ; *p ; p++)
+      {
+        switch(*p)
+        {
+          case '&':  print("&amp;");  break;
+          case '<':  print("&lt;");   break;
+          case '>':  print("&gt;");   break;
+          case '"':  print("&quot;"); break;
+          case '\'': print("&apos;"); break;
+          default:   write(p, 1);     break;
+        }
+      }
+    }
+
+    // Print text as a quoted JSON string
+    void printJson(const char *text)
+    {
+      print("\"");
+      for(const char *p = text ; *p ; p++)
+      {
+        if(*p == '"' || *p == '\\')
+        {
+          print("\\");
+          write(p, 1);
+        }
+        else if((uint8_t)*p < ' ')
+          printf("\\u%04x", *p);
+        else
+          write(p, 1);
+      }
+      print("\"");
+    }
+
+    // Number of bytes stored into the chunk, 0 past the page end
+    size_t length() const
+    {
+      return(pos <= start ? 0 : pos - start < size ? pos - start : size);
+    }
+
+  private:
+    uint8_t *buf;
+    size_t size;
+    size_t start;   // Page offset of the chunk
+    size_t pos;     // Page offset of the next byte
+
+    void write(const char *data, size_t len)
+    {
+      size_t from = pos > start ? pos : start;
+      size_t to   = pos + len < start + size ? pos + len : start + size;
+
+      if(from < to) memcpy(buf + from - start, data + from - pos, to - from);
+      pos += len;
+    }
+};
+
+//
+// Send a streamed page, render() is called for every chunk
+//
+template<typename T>
+static void webSendPage(AsyncWebServerRequest *request, const char *type, void (*render)(WebWriter &, const T &), const T &info, int code = 200, const WebCacheTag *tag = NULL)
+{
+  // Do not start pages that would run the heap out
+  if(ESP.getMaxAllocHeap() < WEB_PAGE_MIN_HEAP)
+  {
+    request->send(503, "text/plain", "Low memory");
+    return;
+  }
+
+  // Heap use is measured from here, including the response itself
+  uint32_t heap = ESP.getFreeHeap();
+
+  // Snapshot lives on the heap, the web server task has a small stack
+  std::shared_ptr<const T> snapshot = std::make_shared<const T>(info);
+
+  AsyncWebServerResponse *response = request->beginChunkedResponse(type,
+    [render, snapshot, heap] (uint8_t *buf, size_t maxLen, size_t index) -> size_t {
+      WebWriter out(buf, maxLen, index);
+      render(out, *snapshot);
+
+      uint32_t free = ESP.getFreeHeap();
+      if(heap > free && heap - free > webPageHeap) webPageHeap = heap - free;
+
+      return(out.length());
+    }
+  );
+
+  response->setCode(code);
+
+  // Let browsers keep the page and ask if it changed
+  if(tag)
+  {
+    response->addHeader("Cache-Control", "no-cache");
+    response->addHeader("ETag", tag->etag);
+    if(tag->modified[0]) response->addHeader("Last-Modified", tag->modified);
+  }
+
+  request->send(response);
+}
+
+#endif
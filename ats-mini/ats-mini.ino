@@ -14,16 +14,22 @@
 #include "EIBI.h"
 #include "Remote.h"
 #include "BleMode.h"
+#include "Telemetry.h"
+#include "RemoteUdp.h"
+#include "RemoteWs.h"
+#include "Script.h"
+#include "WebApi.h"
+#include "Ota.h"
 
 // SI473/5 and UI
 #define MIN_ELAPSED_TIME         5  // 300
 #define MIN_ELAPSED_RSSI_TIME  200  // RSSI check uses IN_ELAPSED_RSSI_TIME * 6 = 1.2s
+#define RSSI_DISPLAY_TIME     1600  // Displayed RSSI and SNR update period (every 8th sample)
 #define ELAPSED_COMMAND      10000  // time to turn off the last command controlled by encoder. Time to goes back to the VFO control // G8PTN: Increased time and corrected comment
 #define DEFAULT_VOLUME          35  // change it for your favorite sound volume
 #define DEFAULT_SLEEP            0  // Default sleep interval, range = 0 (off) to 255 in steps of 5
 #define RDS_CHECK_TIME         250  // Increased from 90
 #define SEEK_TIMEOUT        600000  // Max seek timeout (ms)
-#define NTP_CHECK_TIME       60000  // NTP time refresh period (ms)
 #define SCHEDULE_CHECK_TIME   2000  // How often to identify the same frequency (ms)
 #define BACKGROUND_REFRESH_TIME 5000    // Background screen refresh time. Covers the situation where there are no other events causing a refresh
 
@@ -44,7 +50,6 @@ long elapsedButton = millis();
 
 long lastStrengthCheck = millis();
 long lastRDSCheck = millis();
-long lastNTPCheck = millis();
 long lastScheduleCheck = millis();
 
 long elapsedCommand = millis();
@@ -243,6 +248,9 @@ void setup()
   // If loading bands fails, save default bands
   if(!prefsLoad(SAVE_BANDS|SAVE_VERIFY)) prefsSave(SAVE_BANDS);
 
+  // Restore clock kept over a software reset
+  clockInit();
+
   // Audio Amplifier Enable. G8PTN: Added
   // After the SI4732 has been setup, enable the audio amplifier
   if(PIN_AMP_EN >= 0) digitalWrite(PIN_AMP_EN, HIGH);
@@ -253,6 +261,9 @@ void setup()
   rx.setVolume(volume);
   rx.setMaxSeekTime(SEEK_TIMEOUT);
 
+  // Measure battery before drawing its status
+  telemetryTickTime();
+
   // Draw display for the first time
   drawScreen();
   ledcWrite(PIN_LCD_BL, currentBrt);
@@ -548,7 +559,8 @@ bool consumeAbortPending()
 void showFrequencySeek(uint16_t freq)
 {
   currentFrequency = freq;
-  drawScreen();
+  drawRequest(REDRAW_INPUT);
+  drawTickTime();
 }
 
 //
@@ -699,12 +711,12 @@ bool clickFreq(bool shortPress)
 
 bool processRssiSnr()
 {
-  static uint32_t updateCounter = 0;
+  static uint32_t updateTime = 0;
   bool needRedraw = false;
 
-  rx.getCurrentReceivedSignalQuality();
-  int newRSSI = rx.getCurrentRSSI();
-  int newSNR = rx.getCurrentSNR();
+  telemetrySampleSignal();
+  int newRSSI = telemetryGet()->rssi;
+  int newSNR = telemetryGet()->snr;
 
   // Apply squelch if the volume is not muted
   uint8_t squelchValue = currentSquelch[currentMode] & 0x7f;
@@ -726,8 +738,10 @@ bool processRssiSnr()
   }
 
   // G8PTN: Based on 1.2s interval, update RSSI & SNR
-  if(!(updateCounter++ & 7))
+  // (sampling gets faster for remote telemetry, the display does not)
+  if(millis() - updateTime >= RSSI_DISPLAY_TIME)
   {
+    updateTime = millis();
     // Show RSSI status only if this condition has changed
     if(newRSSI != rssi)
     {
@@ -758,29 +772,30 @@ void loop()
 
   ButtonTracker::State pb1st = pb1.update(digitalRead(ENCODER_PUSH_BUTTON) == LOW);
 
+  // Turning or pressing the encoder takes the receiver back from a script
+  if(encCount || pb1st.isPressed) scriptStop();
+
   // if(encCount && getCpuFrequencyMhz()!=240) setCpuFrequencyMhz(240);
 
-  // Receive and execute serial command
-  int ser_event = serialLoop(usbModeIdx);
-  needRedraw |= !!(ser_event & REMOTE_CHANGED);
-  pb1st.isPressed |= !!(ser_event & REMOTE_PRESSED);
-  pb1st.wasClicked |= !!(ser_event & REMOTE_CLICK);
-  pb1st.wasShortPressed |= !!(ser_event & REMOTE_SHORT_PRESS);
-  int ser_direction = ser_event >> REMOTE_DIRECTION;
-  encCount = ser_direction? ser_direction : encCount;
-  encCountAccel = ser_direction? ser_direction : encCountAccel;
-  if(ser_event & REMOTE_PREFS) prefsRequestSave(SAVE_ALL);
-
-  // Receive and execute BLE command
-  int ble_event = bleLoop(bleModeIdx);
-  needRedraw |= !!(ble_event & REMOTE_CHANGED);
-  pb1st.isPressed |= !!(ble_event & REMOTE_PRESSED);
-  pb1st.wasClicked |= !!(ble_event & REMOTE_CLICK);
-  pb1st.wasShortPressed |= !!(ble_event & REMOTE_SHORT_PRESS);
-  int ble_direction = ble_event >> REMOTE_DIRECTION;
-  encCount = ble_direction? ble_direction : encCount;
-  encCountAccel = ble_direction? ble_direction : encCountAccel;
-  if(ble_event & REMOTE_PREFS) prefsRequestSave(SAVE_ALL);
+  // Serve network clients
+  udpLoop();
+  wsRemoteLoop();
+
+  // Receive and execute remote commands: binary, CAT, and HID
+  // transports, one command from the ad hoc sessions, and the
+  // changes queued by the web pages and API
+  int remoteEvents[] = { serialLoop(usbModeIdx), bleLoop(bleModeIdx), remoteLoop(), webLoop(), webApiLoop() };
+  for(int event : remoteEvents)
+  {
+    needRedraw |= !!(event & REMOTE_CHANGED);
+    pb1st.isPressed |= !!(event & REMOTE_PRESSED);
+    pb1st.wasClicked |= !!(event & REMOTE_CLICK);
+    pb1st.wasShortPressed |= !!(event & REMOTE_SHORT_PRESS);
+    int direction = event >> REMOTE_DIRECTION;
+    encCount = direction? direction : encCount;
+    encCountAccel = direction? direction : encCountAccel;
+    if(event & REMOTE_PREFS) prefsRequestSave(SAVE_ALL);
+  }
 
   // Block encoder rotation when in the locked sleep mode
   if(encCount && sleepOn() && sleepModeIdx==SLEEP_LOCKED) encCount = encCountAccel = 0;
@@ -949,7 +964,18 @@ void loop()
     elapsedSleep = elapsedCommand = currentTime = millis();
   }
 
-  if((currentTime - elapsedRSSI) > MIN_ELAPSED_RSSI_TIME)
+  // Changes caused by user input get drawn at the full frame rate
+  if(needRedraw) drawRequest(REDRAW_INPUT);
+  needRedraw = false;
+
+  // Remote telemetry subscribers may need signal quality more often
+  uint16_t rssiPeriod = MIN_ELAPSED_RSSI_TIME;
+  uint16_t samplePeriod = serialSamplePeriod(usbModeIdx);
+  if(samplePeriod && samplePeriod < rssiPeriod) rssiPeriod = samplePeriod;
+  samplePeriod = bleSamplePeriod(bleModeIdx);
+  if(samplePeriod && samplePeriod < rssiPeriod) rssiPeriod = samplePeriod;
+
+  if((currentTime - elapsedRSSI) >= rssiPeriod)
   {
     needRedraw |= processRssiSnr();
     elapsedRSSI = currentTime;
@@ -969,34 +995,38 @@ void loop()
     lastScheduleCheck = currentTime;
   }
 
-  // Periodically synchronize time via NTP
-  if((currentTime - lastNTPCheck) > NTP_CHECK_TIME)
-  {
-    needRedraw |= ntpSyncTime();
-    lastNTPCheck = currentTime;
-  }
-
   // Tick preferences time, saving changes when there has
   // been no activity for a while
   prefsTickTime();
 
-  // Tick NETWORK time, connecting to WiFi if requested
-  netTickTime();
+  // Tick NETWORK time, connecting to WiFi and getting NTP time
+  needRedraw |= netTickTime();
+
+  // Confirm new firmware, reboot after a firmware update
+  otaTickTime();
 
   // Run clock
   needRedraw |= clockTickTime();
 
+  // Measure battery voltage and refresh other hardware readings
+  needRedraw |= telemetryTickTime();
+
+  // Step the running script
+  needRedraw |= scriptTickTime();
+
   // Periodically refresh the main screen
   // This covers the case where there is nothing else triggering a refresh
-  if(needRedraw) background_timer = currentTime;
   if((currentTime - background_timer) > BACKGROUND_REFRESH_TIME)
   {
     if(currentCmd == CMD_NONE) needRedraw = true;
     background_timer = currentTime;
   }
 
-  // Redraw screen if necessary
-  if(needRedraw) drawScreen();
+  // Background changes get drawn at a reduced frame rate
+  if(needRedraw) drawRequest(REDRAW_BACKGROUND);
+
+  // Redraw screen if necessary, merging all pending requests
+  if(drawTickTime()) background_timer = currentTime;
 
   // Add a small default delay in the main loop
   delay(5);
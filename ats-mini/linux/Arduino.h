@@ -0,0 +1,145 @@
+#ifndef LINUX_ARDUINO_H
+#define LINUX_ARDUINO_H
+
+//
+// Minimal Arduino API for building firmware modules on a Linux host,
+// see linux/README.md. Only what the host targets use is provided.
+//
+
+#include <stdint.h>
+#include <inttypes.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <math.h>
+#include <sys/time.h>
+#include <arpa/inet.h>
+#include <algorithm>
+
+#define IRAM_ATTR
+#define RTC_DATA_ATTR
+#define RTC_NOINIT_ATTR
+#define PROGMEM
+
+#define HIGH   1
+#define LOW    0
+#define INPUT  0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+
+using std::min;
+using std::max;
+
+typedef uint8_t byte;
+
+// Host time is virtual, it only moves forward in delay() and
+// hostAdvance(), so the results do not depend on the host speed.
+// The time of day (gettimeofday()) follows the same clock.
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void hostAdvance(unsigned long us);
+
+static inline uint32_t getCpuFrequencyMhz() { return(240); }
+static inline void pinMode(int, int) {}
+static inline void digitalWrite(int, int) {}
+static inline int digitalRead(int) { return(HIGH); }
+// About 4V on the battery monitor
+static inline int analogRead(int) { return(2350); }
+static inline void ledcWrite(int, int) {}
+
+//
+// Output, as in the Arduino Print class
+//
+class Print
+{
+  public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buf, size_t size)
+    {
+      size_t j;
+      for(j=0 ; j<size && write(buf[j]) ; j++);
+      return(j);
+    }
+    virtual int availableForWrite() { return(0x7FFF); }
+    virtual void flush() {}
+
+    size_t write(const char *str) { return(write((const uint8_t *)str, strlen(str))); }
+    size_t write(const char *buf, size_t size) { return(write((const uint8_t *)buf, size)); }
+    size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+
+    size_t print(const char *str) { return(write(str)); }
+    size_t print(char c) { return(write((uint8_t)c)); }
+    size_t print(long n, int base = 10);
+    size_t print(unsigned long n, int base = 10);
+    size_t print(int n, int base = 10) { return(print((long)n, base)); }
+    size_t print(unsigned int n, int base = 10) { return(print((unsigned long)n, base)); }
+    size_t print(double n, int digits = 2);
+
+    size_t println() { return(write("\r\n")); }
+    template<typename T> size_t println(T value) { return(print(value) + println()); }
+    template<typename T> size_t println(T value, int base) { return(print(value, base) + println()); }
+};
+
+//
+// Input, as in the Arduino Stream class
+//
+class Stream : public Print
+{
+  public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+
+    size_t readBytes(uint8_t *buf, size_t size)
+    {
+      size_t j;
+      for(j=0 ; j<size && available() ; j++) buf[j] = read();
+      return(j);
+    }
+    size_t readBytes(char *buf, size_t size) { return(readBytes((uint8_t *)buf, size)); }
+};
+
+//
+// Serial port writing to the standard output, with no input
+//
+class HostSerial : public Stream
+{
+  public:
+    size_t write(uint8_t c) override { return(fputc(c, stdout) == EOF ? 0 : 1); }
+    using Print::write;
+    int available() override { return(0); }
+    int read() override { return(-1); }
+    int peek() override { return(-1); }
+    operator bool() const { return(true); }
+};
+
+extern HostSerial Serial;
+
+//
+// Chip information, the cycle counter runs at getCpuFrequencyMhz()
+// off the real host clock for benchmarks
+//
+class HostEsp
+{
+  public:
+    uint32_t getCycleCount();
+    const char *getChipModel() { return("Host"); }
+    uint8_t getChipRevision() { return(0); }
+    uint64_t getEfuseMac() { return(0x563412EFCDABULL); }
+    uint32_t getCpuFreqMHz() { return(getCpuFrequencyMhz()); }
+    uint32_t getFlashChipSize() { return(8 * 1024 * 1024); }
+    uint32_t getSketchSize() { return(1536 * 1024); }
+    uint32_t getFreeSketchSpace() { return(3 * 1024 * 1024); }
+    uint32_t getHeapSize() { return(320 * 1024); }
+    uint32_t getFreeHeap() { return(200 * 1024); }
+    uint32_t getPsramSize() { return(8 * 1024 * 1024); }
+    uint32_t getFreePsram() { return(8 * 1024 * 1024); }
+};
+
+extern HostEsp ESP;
+
+#endif // LINUX_ARDUINO_H
@@ -0,0 +1,37 @@
+#ifndef LINUX_BLE_DEVICE_H
+#define LINUX_BLE_DEVICE_H
+
+//
+// NimBLE types used by the BLE headers, there is no Bluetooth on
+// the host and the BLE modules are not built
+//
+
+#include <Arduino.h>
+#include <string>
+#include "host/ble_gap.h"
+
+class BLEServer;
+class BLEService;
+class BLEAdvertising;
+class BLECharacteristic;
+
+class BLEServerCallbacks
+{
+  public:
+    virtual ~BLEServerCallbacks() {}
+    virtual void onConnect(BLEServer *, ble_gap_conn_desc *) {}
+    virtual void onDisconnect(BLEServer *, ble_gap_conn_desc *) {}
+};
+
+class BLECharacteristicCallbacks
+{
+  public:
+    enum Status { SUCCESS_INDICATE, SUCCESS_NOTIFY, ERROR_INDICATE_DISABLED, ERROR_NOTIFY_DISABLED, ERROR_GATT, ERROR_NO_CLIENT, ERROR_INDICATE_TIMEOUT, ERROR_INDICATE_FAILURE };
+
+    virtual ~BLECharacteristicCallbacks() {}
+    virtual void onWrite(BLECharacteristic *, ble_gap_conn_desc *) {}
+    virtual void onSubscribe(BLECharacteristic *, ble_gap_conn_desc *, uint16_t) {}
+    virtual void onStatus(BLECharacteristic *, Status, uint32_t) {}
+};
+
+#endif // LINUX_BLE_DEVICE_H
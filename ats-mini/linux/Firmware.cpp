@@ -0,0 +1,159 @@
+#include "Common.h"
+#include "Button.h"
+#include "Menu.h"
+#include "Telemetry.h"
+#include "Firmware.h"
+
+//
+// Parts of ats-mini.ino and of the hardware modules used by the
+// screen drawing code, kept to what the host targets need
+//
+
+HostRadio hostRadio;
+
+int8_t agcIdx = 0;
+uint8_t disableAgc = 0;
+int8_t agcNdx = 0;
+int8_t softMuteMaxAttIdx = 4;
+
+volatile bool seekStop = false;
+bool pushAndRotate = false;
+uint16_t currentFrequency;
+
+int8_t FmAgcIdx = 0;
+int8_t AmAgcIdx = 0;
+int8_t SsbAgcIdx = 0;
+int8_t AmAvcIdx = 48;
+int8_t SsbAvcIdx = 48;
+int8_t AmSoftMuteIdx = 4;
+int8_t SsbSoftMuteIdx = 4;
+
+uint8_t volume = 35;
+uint8_t currentSquelch[4] = {0};
+uint8_t FmRegionIdx = 0;
+
+uint16_t currentBrt = 130;
+uint16_t currentSleep = 0;
+bool zoomMenu = false;
+int8_t scrollDirection = 1;
+
+uint16_t currentCmd  = CMD_NONE;
+uint8_t  currentMode = FM;
+int16_t  currentBFO  = 0;
+
+uint8_t  rssi = 0;
+uint8_t  snr  = 0;
+
+ButtonTracker pb1 = ButtonTracker();
+TFT_eSPI tft    = TFT_eSPI();
+TFT_eSprite spr = TFT_eSprite(&tft);
+SI4735_fixed rx;
+
+//
+// ats-mini.ino
+//
+
+void useBand(const Band *band)
+{
+  currentFrequency = band->currentFreq;
+  currentMode = band->bandMode;
+  currentBFO = 0;
+  rx.setFrequency(currentFrequency);
+}
+
+bool updateFrequency(int newFreq, bool wrap)
+{
+  Band *band = getCurrentBand();
+
+  if(newFreq < band->minimumFreq || newFreq > band->maximumFreq)
+  {
+    if(!wrap) return(false);
+    newFreq = newFreq < band->minimumFreq ? band->maximumFreq : band->minimumFreq;
+  }
+
+  rx.setFrequency(newFreq);
+  currentFrequency = rx.getFrequency();
+  currentBFO = 0;
+  band->currentFreq = currentFrequency;
+  return(true);
+}
+
+bool updateBFO(int newBFO, bool)
+{
+  currentBFO = isSSB() ? newBFO : 0;
+  return(true);
+}
+
+bool clickFreq(bool)
+{
+  return(false);
+}
+
+//
+// Station.cpp
+//
+
+const char *getStationName() { return(hostRadio.stationName ? hostRadio.stationName : ""); }
+const char *getRadioText() { return(hostRadio.radioText ? hostRadio.radioText : ""); }
+const char *getProgramInfo() { return(hostRadio.programInfo ? hostRadio.programInfo : ""); }
+uint16_t getRdsPiCode() { return(hostRadio.piCode); }
+void clearStationInfo() {}
+bool identifyFrequency(uint16_t, bool) { return(false); }
+
+//
+// Scan.cpp, with a few stations over a noise floor
+//
+
+static float scanLevel(uint16_t freq, float floor)
+{
+  static const uint16_t peaks[] = { 3, 11, 17, 28, 36 };
+  float level = floor;
+
+  for(unsigned int j=0 ; j<ITEM_COUNT(peaks) ; j++)
+  {
+    float d = ((freq / 10) % 41) - peaks[j];
+    level += (0.9 - floor) * exp(-d * d / 2.0) * (j + 2) / 6;
+  }
+
+  return(min(level, 1.0F));
+}
+
+void scanRun(uint16_t, uint16_t) { hostRadio.scanDone = true; }
+float scanGetRSSI(uint16_t freq) { return(hostRadio.scanDone ? scanLevel(freq, 0.2) : 0.0); }
+float scanGetSNR(uint16_t freq) { return(hostRadio.scanDone ? scanLevel(freq, 0.05) * 0.8 : 0.0); }
+
+//
+// Telemetry.cpp
+//
+
+const Telemetry *telemetryGet()
+{
+  static Telemetry tlm;
+
+  tlm.rssi    = rssi;
+  tlm.snr     = snr;
+  tlm.pilot   = hostRadio.pilot;
+  tlm.voltage = 4.0;
+  return(&tlm);
+}
+
+void telemetryReadAntCap() {}
+
+//
+// Network.cpp, BleMode.cpp, EIBI.cpp, Storage.cpp
+//
+
+int8_t getWiFiStatus() { return(hostRadio.wifiStatus); }
+uint8_t getWiFiProgress() { return(0); }
+bool getWiFiMessage(const char **, const char **) { return(false); }
+char *getWiFiIPAddress() { static char ip[] = "192.168.4.1"; return(ip); }
+void netInit(uint8_t, bool) {}
+void netStop() {}
+
+int8_t getBleStatus() { return(hostRadio.bleStatus); }
+void bleInit(uint8_t) {}
+
+bool eibiAvailable() { return(false); }
+bool eibiLoadSchedule() { return(false); }
+
+bool prefsAreWritten() { return(hostRadio.prefsWritten); }
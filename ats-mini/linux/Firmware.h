@@ -0,0 +1,25 @@
+#ifndef LINUX_FIRMWARE_H
+#define LINUX_FIRMWARE_H
+
+#include "Common.h"
+
+//
+// Receiver state not kept by the firmware modules built on the host,
+// normally coming from RDS, the network, BLE, and the scanner
+//
+typedef struct
+{
+  const char *stationName;  // getStationName()
+  const char *radioText;    // getRadioText(), ends with two zeros
+  const char *programInfo;  // getProgramInfo()
+  uint16_t piCode;          // getRdsPiCode()
+  bool pilot;               // FM stereo pilot
+  int8_t wifiStatus;        // getWiFiStatus()
+  int8_t bleStatus;         // getBleStatus()
+  bool prefsWritten;        // prefsAreWritten()
+  bool scanDone;            // Scan data is available
+} HostRadio;
+
+extern HostRadio hostRadio;
+
+#endif // LINUX_FIRMWARE_H
@@ -0,0 +1,93 @@
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <time.h>
+
+HostSerial Serial;
+HostEsp ESP;
+HostFS LittleFS;
+
+// Virtual time (us) and the time of day it started at
+static uint64_t hostTime = 0;
+static int64_t hostEpoch = 0;
+
+unsigned long millis() { return(hostTime / 1000); }
+unsigned long micros() { return(hostTime); }
+void delay(unsigned long ms) { hostTime += (uint64_t)ms * 1000; }
+void hostAdvance(unsigned long us) { hostTime += us; }
+
+//
+// Replace the C library time of day with the virtual time, so that
+// the firmware clock neither sees nor sets the host clock
+//
+extern "C" int gettimeofday(struct timeval *tv, void *) noexcept
+{
+  int64_t now = hostEpoch + hostTime;
+  tv->tv_sec  = now / 1000000;
+  tv->tv_usec = now % 1000000;
+  return(0);
+}
+
+extern "C" int settimeofday(const struct timeval *tv, const struct timezone *) noexcept
+{
+  hostEpoch = (int64_t)tv->tv_sec * 1000000 + tv->tv_usec - hostTime;
+  return(0);
+}
+
+// Real host time in cycles of the ESP32 clock, for benchmarks
+uint32_t HostEsp::getCycleCount()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  uint64_t ns = (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+  return(ns * getCpuFrequencyMhz() / 1000);
+}
+
+//
+// Print
+//
+
+size_t Print::printf(const char *format, ...)
+{
+  char buf[256];
+  va_list args;
+
+  va_start(args, format);
+  int len = vsnprintf(buf, sizeof(buf), format, args);
+  va_end(args);
+
+  if(len < 0) return(0);
+  if(len < (int)sizeof(buf)) return(write((const uint8_t *)buf, len));
+
+  // Does not fit the buffer, print again into a larger one
+  char *big = (char *)malloc(len + 1);
+  if(!big) return(0);
+  va_start(args, format);
+  vsnprintf(big, len + 1, format, args);
+  va_end(args);
+  size_t result = write((const uint8_t *)big, len);
+  free(big);
+  return(result);
+}
+
+size_t Print::print(long n, int base)
+{
+  if(n >= 0 || base != 10) return(print((unsigned long)n, base));
+  return(print('-') + print((unsigned long)-n, base));
+}
+
+size_t Print::print(unsigned long n, int base)
+{
+  char buf[8 * sizeof(long) + 1];
+  char *p = buf + sizeof(buf) - 1;
+
+  if(base < 2) base = 10;
+  *p = '\0';
+  do *--p = "0123456789ABCDEF"[n % base]; while(n /= base);
+
+  return(write(p));
+}
+
+size_t Print::print(double n, int digits)
+{
+  return(printf("%.*f", digits, n));
+}
@@ -0,0 +1,16 @@
+#ifndef LINUX_LITTLEFS_H
+#define LINUX_LITTLEFS_H
+
+#include <stddef.h>
+
+// File system sizes shown in the About screen
+class HostFS
+{
+  public:
+    size_t totalBytes() { return(1024 * 1024); }
+    size_t usedBytes() { return(64 * 1024); }
+};
+
+extern HostFS LittleFS;
+
+#endif // LINUX_LITTLEFS_H
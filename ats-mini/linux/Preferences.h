@@ -0,0 +1,9 @@
+#ifndef LINUX_PREFERENCES_H
+#define LINUX_PREFERENCES_H
+
+// Only declared by Storage.h, the host targets do not save anything
+class Preferences
+{
+};
+
+#endif // LINUX_PREFERENCES_H
@@ -0,0 +1,363 @@
+#include "Common.h"
+#include "Themes.h"
+#include "Menu.h"
+#include "Remote.h"
+#include "RemoteBinary.h"
+#include "Cat.h"
+#include "Script.h"
+#include <string>
+
+//
+// Feed the ad hoc remote protocol parser with canned, split,
+// overlong, stalled, and random input, then time it.
+//
+//   remote [-b]
+//
+//   -b  Time the parser after the tests
+//
+
+#define LINE_TIMEOUT 10000  // REMOTE_LINE_TIMEOUT in Remote.cpp (ms)
+
+//
+// Client connection, hands over at most `chunk` input bytes per
+// remoteReceive() call and keeps everything the parser writes back
+//
+class FakeStream : public Stream
+{
+  public:
+    std::string input;
+    size_t pos = 0;
+    size_t chunk = 0;      // Bytes available per call, 0 for all
+    size_t given = 0;      // Bytes taken since the last call
+    std::string output;
+
+    size_t write(uint8_t c) override { output += (char)c; return(1); }
+    using Print::write;
+
+    int available() override
+    {
+      size_t left = input.size() - pos;
+      if(chunk) left = min(left, chunk > given ? chunk - given : 0);
+      return(left);
+    }
+
+    int read() override
+    {
+      if(!available()) return(-1);
+      given++;
+      return((uint8_t)input[pos++]);
+    }
+
+    int peek() override { return(available() ? (uint8_t)input[pos] : -1); }
+
+    void send(const std::string &text) { input += text; }
+    bool done() const { return(pos >= input.size()); }
+    void nextCall() { given = 0; }
+};
+
+//
+// Modules Remote.cpp dispatches to, not under test here
+//
+void binaryTickTime(Stream *, BinaryState *) {}
+int binaryReceive(Stream *, BinaryState *) { return(0); }
+uint16_t binarySamplePeriod(const BinaryState *) { return(0); }
+int catReceive(Stream *, CatState *) { return(0); }
+
+static std::string scriptName;
+const char *scriptRun(const char *name) { scriptName = name; return(NULL); }
+void scriptStop() { scriptName.clear(); }
+const char *scriptRunning() { return(scriptName.empty() ? NULL : scriptName.c_str()); }
+
+//
+// Checks
+//
+
+static int failed = 0;
+static int checks = 0;
+
+#define CHECK(test, cond) \
+  do { \
+    checks++; \
+    if(!(cond)) { printf("%-16s FAILED %s (line %d)\n", test, #cond, __LINE__); failed++; } \
+  } while(0)
+
+static bool contains(const std::string &text, const char *what)
+{
+  return(text.find(what) != std::string::npos);
+}
+
+// Call remoteReceive() until the input runs out, return all events
+static int receiveAll(FakeStream *stream, RemoteState *state, uint32_t usPerCall = 0)
+{
+  int events = 0;
+
+  for(int j=0 ; j<1000000 && !stream->done() ; j++)
+  {
+    stream->nextCall();
+    events |= remoteReceive(stream, state);
+    hostAdvance(usPerCall);
+  }
+
+  stream->nextCall();
+  return(events | remoteReceive(stream, state));
+}
+
+static void selectBandByName(const char *name)
+{
+  for(int j=0 ; j<getTotalBands() ; j++)
+    if(!strcmp(bands[j].bandName, name)) { selectBand(j, false); break; }
+}
+
+//
+// Tests
+//
+
+static void testCommands()
+{
+  FakeStream stream;
+  RemoteState state;
+
+  // Unknown characters are ignored
+  stream.send("\r\n ?");
+  CHECK("commands", receiveAll(&stream, &state) == 0);
+
+  // Single character commands run one per call
+  stream.send("tt");
+  stream.nextCall();
+  CHECK("commands", remoteReceive(&stream, &state) == REMOTE_CHANGED);
+  CHECK("commands", state.remoteLogOn);
+  stream.nextCall();
+  CHECK("commands", remoteReceive(&stream, &state) == REMOTE_CHANGED);
+  CHECK("commands", !state.remoteLogOn);
+
+  // Encoder rotation carries its direction
+  stream.send("r");
+  stream.nextCall();
+  int event = remoteReceive(&stream, &state);
+  CHECK("commands", (event >> REMOTE_DIRECTION) == -1);
+  CHECK("commands", event & REMOTE_PREFS);
+
+  printf("%-16s %s\n", "commands", failed ? "FAILED" : "OK");
+}
+
+static void testLines()
+{
+  int before = failed;
+  FakeStream stream;
+  RemoteState state;
+
+  selectBandByName("MW2");
+
+  // Command line with CRLF, the LF is not taken for a new command
+  stream.send("F999000\r\n");
+  int event = receiveAll(&stream, &state);
+  CHECK("lines", event == (REMOTE_CHANGED | REMOTE_PREFS));
+  CHECK("lines", currentFrequency == 999);
+  CHECK("lines", !state.remoteCmd);
+  CHECK("lines", stream.output == "F999000\r\n");
+
+  // Invalid argument is reported, the parser goes on
+  stream.output.clear();
+  stream.send("F12x\nF1000000\n");
+  receiveAll(&stream, &state);
+  CHECK("lines", contains(stream.output, "Error: Expected newline"));
+  CHECK("lines", currentFrequency == 1000);
+
+  // Script name is passed as is, empty name stops the script
+  stream.output.clear();
+  stream.send("Xscan.txt\rX\n");
+  stream.nextCall();
+  remoteReceive(&stream, &state);
+  stream.nextCall();
+  remoteReceive(&stream, &state);
+  CHECK("lines", scriptName == "scan.txt");
+  CHECK("lines", contains(stream.output, "Script started"));
+  receiveAll(&stream, &state);
+  CHECK("lines", scriptName.empty());
+  CHECK("lines", contains(stream.output, "Script stopped"));
+
+  printf("%-16s %s\n", "lines", failed > before ? "FAILED" : "OK");
+}
+
+static void testSplit()
+{
+  int before = failed;
+  static const char line[] = "#5,MW2,1206000,AM\r";
+
+  // Same line delivered one byte per call up to all at once
+  for(size_t chunk=1 ; chunk<=sizeof(line) ; chunk++)
+  {
+    FakeStream stream;
+    RemoteState state;
+
+    memories[4].freq = 0;
+    stream.chunk = chunk;
+    stream.send(line);
+
+    int event = receiveAll(&stream, &state, 1000);
+    CHECK("split", event == (REMOTE_CHANGED | REMOTE_PREFS));
+    CHECK("split", memories[4].freq == 1206000);
+    CHECK("split", !contains(stream.output, "Error"));
+  }
+
+  printf("%-16s %s\n", "split", failed > before ? "FAILED" : "OK");
+}
+
+static void testOverlong()
+{
+  int before = failed;
+  FakeStream stream;
+  RemoteState state;
+
+  // Line far beyond the buffer is dropped as a whole
+  stream.send("F" + std::string(REMOTE_LINE_SIZE * 4, '7') + "\n");
+  int event = receiveAll(&stream, &state);
+  CHECK("overlong", event == 0);
+  CHECK("overlong", contains(stream.output, "Error: Line is too long"));
+  CHECK("overlong", state.remoteLineLen == REMOTE_LINE_SIZE - 1);
+  CHECK("overlong", !state.remoteCmd);
+
+  // Line that just fits is parsed
+  stream.output.clear();
+  stream.send("X" + std::string(REMOTE_LINE_SIZE - 1, 'a') + "\n");
+  receiveAll(&stream, &state);
+  CHECK("overlong", !contains(stream.output, "too long"));
+  CHECK("overlong", scriptName.size() == REMOTE_LINE_SIZE - 1);
+
+  // Next command works
+  stream.output.clear();
+  stream.send("X\n");
+  receiveAll(&stream, &state);
+  CHECK("overlong", scriptName.empty());
+
+  printf("%-16s %s\n", "overlong", failed > before ? "FAILED" : "OK");
+}
+
+static void testTimeout()
+{
+  int before = failed;
+  FakeStream stream;
+  RemoteState state;
+
+  // Every received byte restarts the timeout
+  stream.send("F99");
+  receiveAll(&stream, &state);
+  hostAdvance((LINE_TIMEOUT - 1000) * 1000);
+  stream.send("9");
+  receiveAll(&stream, &state);
+  hostAdvance((LINE_TIMEOUT - 1000) * 1000);
+  receiveAll(&stream, &state);
+  CHECK("timeout", state.remoteCmd == 'F');
+  CHECK("timeout", !contains(stream.output, "Timeout"));
+
+  // Stalled line is dropped once
+  hostAdvance(2000 * 1000);
+  CHECK("timeout", receiveAll(&stream, &state) == 0);
+  CHECK("timeout", !state.remoteCmd);
+  CHECK("timeout", contains(stream.output, "Error: Timeout"));
+  stream.output.clear();
+  receiveAll(&stream, &state);
+  CHECK("timeout", stream.output.empty());
+
+  // Rest of the stalled line is taken for commands
+  stream.send("000\r");
+  CHECK("timeout", receiveAll(&stream, &state) == 0);
+
+  printf("%-16s %s\n", "timeout", failed > before ? "FAILED" : "OK");
+}
+
+static void testRandom()
+{
+  int before = failed;
+  FakeStream stream;
+  RemoteState state;
+  uint32_t seed = 12345;
+
+  // Random bytes, with more line commands and separators than
+  // chance gives, served by remoteLoop() with screenshot and memory
+  // list jobs. The benchmark command is left out, it takes seconds.
+  remoteOpen(&stream, &state);
+  for(int j=0 ; j<200000 ; j++)
+  {
+    seed = seed * 1103515245 + 12345;
+    uint8_t ch = seed >> 16;
+    if((seed >> 8) % 8 == 0) ch = "#FX^T\r\n,"[(seed >> 12) % 8];
+    if(ch != 'p') stream.input += (char)ch;
+  }
+
+  for(int j=0 ; j<2000000 && (!stream.done() || state.remoteJob) ; j++)
+  {
+    stream.chunk = 1 + j % 7;
+    stream.nextCall();
+    remoteLoop();
+    hostAdvance(500);
+
+    if(state.remoteLineLen >= REMOTE_LINE_SIZE || (state.remoteCmd && !strchr("#FX^", state.remoteCmd)))
+    {
+      CHECK("random", false);
+      break;
+    }
+  }
+
+  CHECK("random", stream.done());
+  CHECK("random", !state.remoteJob);
+  remoteClose(&state);
+  if(switchThemeEditor()) switchThemeEditor(false);
+
+  printf("%-16s %s (%u bytes in, %u bytes out)\n", "random", failed > before ? "FAILED" : "OK",
+         (unsigned int)stream.input.size(), (unsigned int)stream.output.size());
+}
+
+//
+// Parser speed, in ESP32 cycles per command off the host clock
+//
+static void benchmark()
+{
+  static const struct { const char *name; const char *line; } cases[] =
+  {
+    { "Character", "t" },
+    { "Frequency", "F1000000\r" },
+    { "Memory",    "#5,MW2,1206000,AM\r" },
+  };
+
+  selectBandByName("MW2");
+  printf("\nCommand,Count,Cycles,AvgUs (240MHz)\n");
+
+  for(unsigned int k=0 ; k<ITEM_COUNT(cases) ; k++)
+  {
+    FakeStream stream;
+    RemoteState state;
+    const int count = 100000;
+
+    stream.input.reserve(count * strlen(cases[k].line));
+    for(int j=0 ; j<count ; j++) stream.input += cases[k].line;
+    stream.output.reserve(count * (strlen(cases[k].line) + 4));
+
+    uint32_t start = ESP.getCycleCount();
+    while(!stream.done()) remoteReceive(&stream, &state);
+    uint32_t cycles = (ESP.getCycleCount() - start) / count;
+
+    printf("%s,%d,%u,%.2f\n", cases[k].name, count, cycles, (float)cycles / getCpuFrequencyMhz());
+  }
+}
+
+int main(int argc, char **argv)
+{
+  bool bench = argc > 1 && !strcmp(argv[1], "-b");
+
+  spr.createSprite(320, 170);
+
+  testCommands();
+  testLines();
+  testSplit();
+  testOverlong();
+  testTimeout();
+  testRandom();
+
+  if(bench) benchmark();
+
+  if(failed)
+    fprintf(stderr, "%d of %d checks failed\n", failed, checks);
+
+  return(failed ? 1 : 0);
+}
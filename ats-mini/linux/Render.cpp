@@ -0,0 +1,303 @@
+#include "Common.h"
+#include "Themes.h"
+#include "Menu.h"
+#include "Draw.h"
+#include "Profile.h"
+#include "Firmware.h"
+#include <zlib.h>
+#include <string>
+#include <vector>
+
+//
+// Render canned receiver states to PNG files and compare them with
+// the golden images, then time each layout per frame.
+//
+//   render [-u] [-b] GOLDEN_DIR [OUTPUT_DIR]
+//
+//   -u  Update golden images instead of comparing with them
+//   -b  Run the drawing benchmark after rendering
+//
+
+typedef struct
+{
+  const char *name;         // Image file name, without extension
+  uint8_t layout;           // UI_DEFAULT or UI_SMETER
+  const char *band;         // Band name
+  uint16_t cmd;             // Current command
+  uint16_t freq;            // Frequency (band units)
+  int16_t bfo;              // BFO (Hz), SSB only
+  uint8_t rssi;
+  uint8_t snr;
+  HostRadio radio;          // RDS, network, and BLE state
+} Screen;
+
+static const Screen screens[] =
+{
+  { "default-fm", UI_DEFAULT, "VHF", CMD_NONE, 10250, 0, 48, 22,
+    { "RADIO 1", "Morning show with the news at 9\0", "", 0xC201, true, 2, 0, false, false } },
+  { "default-am", UI_DEFAULT, "MW2", CMD_NONE, 999, 0, 31, 9,
+    { "", "", "", 0, false, 0, 0, false, false } },
+  { "default-ssb", UI_DEFAULT, "40M", CMD_NONE, 7074, 500, 18, 4,
+    { "", "", "", 0, false, 0, 1, true, false } },
+  { "default-freq", UI_DEFAULT, "31M", CMD_FREQ, 9650, 0, 40, 15,
+    { "", "", "", 0, false, 1, -1, false, false } },
+  { "default-volume", UI_DEFAULT, "VHF", CMD_VOLUME, 10390, 0, 25, 12,
+    { "", "", "", 0, true, 0, 0, false, false } },
+  { "default-menu", UI_DEFAULT, "ALL", CMD_MENU, 15000, 0, 12, 2,
+    { "", "", "", 0, false, 0, 0, false, false } },
+  { "default-scan", UI_DEFAULT, "41M", CMD_SCAN, 7300, 0, 35, 14,
+    { "", "", "", 0, false, 0, 0, false, true } },
+  { "smeter-fm", UI_SMETER, "VHF", CMD_NONE, 10250, 0, 48, 22,
+    { "RADIO 1", "Morning show with the news at 9\0", "", 0xC201, true, 2, 0, false, false } },
+  { "smeter-ssb", UI_SMETER, "20M", CMD_NONE, 14074, -250, 60, 30,
+    { "", "", "", 0, false, -1, 1, false, false } },
+  { "smeter-band", UI_SMETER, "MW1", CMD_BAND, 810, 0, 20, 5,
+    { "", "", "", 0, false, 0, 0, false, false } },
+  { "about", UI_DEFAULT, "VHF", CMD_ABOUT, 10390, 0, 0, 0,
+    { "", "", "", 0, false, 0, 0, false, false } },
+};
+
+// Remote.cpp is not linked, no screenshots hold the screen
+bool remoteCapturing() { return(false); }
+
+//
+// Set the receiver to a canned state and draw it
+//
+static void renderScreen(const Screen *s)
+{
+  for(int j=0 ; j<getTotalBands() ; j++)
+    if(!strcmp(bands[j].bandName, s->band)) { selectBand(j, false); break; }
+
+  uiLayoutIdx = s->layout;
+  currentCmd  = s->cmd;
+  currentFrequency = s->freq;
+  currentBFO  = s->bfo;
+  rssi        = s->rssi;
+  snr         = s->snr;
+  hostRadio   = s->radio;
+
+  // Battery is measured like in the main loop, the first
+  // measurement has to show the full battery at once
+  batteryTickTime();
+
+  drawScreen();
+}
+
+//
+// PNG files, 8bit RGB without interlacing
+//
+
+static void pngChunk(std::string &png, const char *type, const std::string &data)
+{
+  uint8_t len[4] = { (uint8_t)(data.size() >> 24), (uint8_t)(data.size() >> 16), (uint8_t)(data.size() >> 8), (uint8_t)data.size() };
+  std::string chunk = std::string(type, 4) + data;
+  uLong crc = crc32(0, (const Bytef *)chunk.data(), chunk.size());
+  uint8_t sum[4] = { (uint8_t)(crc >> 24), (uint8_t)(crc >> 16), (uint8_t)(crc >> 8), (uint8_t)crc };
+
+  png.append((const char *)len, 4);
+  png.append(chunk);
+  png.append((const char *)sum, 4);
+}
+
+static bool pngWrite(const std::string &path, const std::vector<uint8_t> &rgb, int w, int h)
+{
+  // Each row starts with filter type 0 (none)
+  std::string raw;
+  for(int y=0 ; y<h ; y++)
+  {
+    raw += '\0';
+    raw.append((const char *)&rgb[y * w * 3], w * 3);
+  }
+
+  uLongf size = compressBound(raw.size());
+  std::string data(size, '\0');
+  if(compress2((Bytef *)&data[0], &size, (const Bytef *)raw.data(), raw.size(), 9) != Z_OK)
+    return(false);
+  data.resize(size);
+
+  uint8_t ihdr[13] = { 0, 0, (uint8_t)(w >> 8), (uint8_t)w, 0, 0, (uint8_t)(h >> 8), (uint8_t)h, 8, 2, 0, 0, 0 };
+  std::string png("\x89PNG\r\n\x1A\n", 8);
+  pngChunk(png, "IHDR", std::string((const char *)ihdr, sizeof(ihdr)));
+  pngChunk(png, "IDAT", data);
+  pngChunk(png, "IEND", "");
+
+  FILE *f = fopen(path.c_str(), "wb");
+  if(!f) return(false);
+  bool ok = fwrite(png.data(), 1, png.size(), f) == png.size();
+  return(!fclose(f) && ok);
+}
+
+static uint32_t pngUint(const uint8_t *p)
+{
+  return(((uint32_t)p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3]);
+}
+
+static int pngPaeth(int a, int b, int c)
+{
+  int p = a + b - c, pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+  return(pa <= pb && pa <= pc ? a : pb <= pc ? b : c);
+}
+
+// Read an 8bit RGB image, as written by pngWrite() or optimizers
+static bool pngRead(const std::string &path, std::vector<uint8_t> &rgb, int w, int h)
+{
+  FILE *f = fopen(path.c_str(), "rb");
+  if(!f) return(false);
+
+  std::string png;
+  char buf[4096];
+  for(size_t n ; (n = fread(buf, 1, sizeof(buf), f)) ; png.append(buf, n));
+  fclose(f);
+
+  const uint8_t *p = (const uint8_t *)png.data();
+  if(png.size() < 8 || memcmp(p, "\x89PNG\r\n\x1A\n", 8)) return(false);
+
+  std::string data;
+  for(size_t pos=8 ; pos+12<=png.size() ; )
+  {
+    uint32_t len = pngUint(p + pos);
+    if(pos + 12 + len > png.size()) return(false);
+
+    const uint8_t *type = p + pos + 4;
+    if(!memcmp(type, "IHDR", 4))
+    {
+      const uint8_t *hdr = type + 4;
+      if((int)pngUint(hdr) != w || (int)pngUint(hdr + 4) != h || hdr[8] != 8 || hdr[9] != 2 || hdr[12])
+        return(false);
+    }
+    else if(!memcmp(type, "IDAT", 4))
+      data.append((const char *)type + 4, len);
+
+    pos += 12 + len;
+  }
+
+  size_t stride = w * 3;
+  std::vector<uint8_t> raw(h * (stride + 1));
+  uLongf size = raw.size();
+  if(uncompress(&raw[0], &size, (const Bytef *)data.data(), data.size()) != Z_OK || size != raw.size())
+    return(false);
+
+  // Undo row filters
+  rgb.assign(h * stride, 0);
+  for(int y=0 ; y<h ; y++)
+  {
+    uint8_t filter = raw[y * (stride + 1)];
+    const uint8_t *in = &raw[y * (stride + 1) + 1];
+    uint8_t *out = &rgb[y * stride];
+    const uint8_t *up = y ? out - stride : NULL;
+
+    for(size_t x=0 ; x<stride ; x++)
+    {
+      int a = x >= 3 ? out[x - 3] : 0;
+      int b = up ? up[x] : 0;
+      int c = up && x >= 3 ? up[x - 3] : 0;
+
+      switch(filter)
+      {
+        case 0: out[x] = in[x]; break;
+        case 1: out[x] = in[x] + a; break;
+        case 2: out[x] = in[x] + b; break;
+        case 3: out[x] = in[x] + (a + b) / 2; break;
+        case 4: out[x] = in[x] + pngPaeth(a, b, c); break;
+        default: return(false);
+      }
+    }
+  }
+
+  return(true);
+}
+
+// Expand the RGB565 sprite to 8bit RGB
+static std::vector<uint8_t> spriteToRGB()
+{
+  std::vector<uint8_t> rgb;
+
+  for(int y=0 ; y<spr.height() ; y++)
+    for(int x=0 ; x<spr.width() ; x++)
+    {
+      uint16_t c = spr.readPixel(x, y);
+      rgb.push_back(((c >> 11) & 0x1F) * 255 / 31);
+      rgb.push_back(((c >> 5) & 0x3F) * 255 / 63);
+      rgb.push_back((c & 0x1F) * 255 / 31);
+    }
+
+  return(rgb);
+}
+
+int main(int argc, char **argv)
+{
+  bool update = false, bench = false;
+  int j;
+
+  for(j=1 ; j<argc && argv[j][0]=='-' ; j++)
+  {
+    if(!strcmp(argv[j], "-u")) update = true;
+    else if(!strcmp(argv[j], "-b")) bench = true;
+    else break;
+  }
+
+  if(j >= argc || argc - j > 2)
+  {
+    fprintf(stderr, "Usage: %s [-u] [-b] GOLDEN_DIR [OUTPUT_DIR]\n", argv[0]);
+    return(2);
+  }
+
+  std::string golden = argv[j];
+  std::string output = j + 1 < argc ? argv[j + 1] : "";
+
+  spr.createSprite(320, 170);
+  spr.setTextDatum(MC_DATUM);
+  spr.setFreeFont(&Orbitron_Light_24);
+  spr.setTextColor(TH.text, TH.bg);
+
+  int failed = 0;
+
+  for(const Screen &s : screens)
+  {
+    renderScreen(&s);
+
+    std::vector<uint8_t> rgb = spriteToRGB();
+    std::string file = std::string("/") + s.name + ".png";
+
+    if(update)
+    {
+      if(!pngWrite(golden + file, rgb, spr.width(), spr.height()))
+      {
+        fprintf(stderr, "%s: Cannot write %s\n", s.name, (golden + file).c_str());
+        failed++;
+      }
+      continue;
+    }
+
+    if(!output.empty()) pngWrite(output + file, rgb, spr.width(), spr.height());
+
+    std::vector<uint8_t> expected;
+    if(!pngRead(golden + file, expected, spr.width(), spr.height()))
+    {
+      printf("%-16s MISSING %s\n", s.name, (golden + file).c_str());
+      failed++;
+      continue;
+    }
+
+    int diff = 0;
+    for(size_t k=0 ; k<rgb.size() ; k+=3)
+      diff += !!memcmp(&rgb[k], &expected[k], 3);
+
+    printf("%-16s %s", s.name, diff ? "FAILED" : "OK");
+    if(diff) printf(" (%d pixels differ)", diff);
+    printf("\n");
+    failed += !!diff;
+  }
+
+  if(bench)
+  {
+    currentCmd = CMD_NONE;
+    profileBenchmark(&Serial);
+    profilePrint(&Serial);
+  }
+
+  if(failed)
+    fprintf(stderr, "%d of %d screens failed\n", failed, (int)ITEM_COUNT(screens));
+
+  return(failed ? 1 : 0);
+}
@@ -0,0 +1,46 @@
+#ifndef LINUX_SI4735_FIXED_H
+#define LINUX_SI4735_FIXED_H
+
+//
+// SI4735_fixed stand-in, settings are ignored and the receiver
+// reports the values stored in it by the host program
+//
+
+#include <Arduino.h>
+
+class SI4735_fixed
+{
+  public:
+    uint16_t frequency = 0;
+    uint8_t rssi = 0;
+    uint8_t snr = 0;
+    uint8_t agcIndex = 0;
+    bool agcEnabled = true;
+
+    uint16_t getFrequency() { return(frequency); }
+    uint16_t getCurrentFrequency() { return(frequency); }
+    uint8_t getCurrentRSSI() { return(rssi); }
+    uint8_t getCurrentSNR() { return(snr); }
+    void getCurrentReceivedSignalQuality() {}
+    void getAutomaticGainControl() {}
+    bool isAgcEnabled() { return(agcEnabled); }
+    uint8_t getAgcGainIndex() { return(agcIndex); }
+
+    void setFrequency(uint16_t freq) { frequency = freq; }
+    void setVolume(uint8_t) {}
+    void setAudioMute(bool) {}
+    void loadPatch(const uint8_t *, size_t, uint8_t) {}
+    void setAutomaticGainControl(uint8_t, uint8_t) {}
+    void setAmSoftMuteMaxAttenuation(uint8_t) {}
+    void setAvcAmMaxGain(uint8_t) {}
+    void setBandwidth(uint8_t, uint8_t) {}
+    void setFmBandwidth(uint8_t) {}
+    void setSSBAudioBandwidth(uint8_t) {}
+    void setSSBSidebandCutoffFilter(uint8_t) {}
+    void setFMDeEmphasis(uint8_t) {}
+    void setFrequencyStep(uint16_t) {}
+    void setSeekAmSpacing(uint16_t) {}
+    void setSeekFmSpacing(uint16_t) {}
+};
+
+#endif // LINUX_SI4735_FIXED_H
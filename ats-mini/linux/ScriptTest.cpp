@@ -0,0 +1,368 @@
+#include "ScriptEngine.h"
+#include <stdio.h>
+#include <string.h>
+#include <string>
+
+//
+// Compile and run scripts against recording radio hooks, checking
+// loops, nesting, else, compile and runtime errors, waits, and the
+// SCRIPT_STEP_COUNT bound.
+//
+//   script
+//
+
+static int failed = 0;
+static int checks = 0;
+
+#define CHECK(test, cond) \
+  do { \
+    checks++; \
+    if(!(cond)) { printf("%-16s FAILED %s (line %d)\n", test, #cond, __LINE__); failed++; } \
+  } while(0)
+
+//
+// Radio hooks, recording every action into the trace
+//
+
+static std::string trace;
+static uint32_t now = 0;
+static uint8_t nextRssi = 0;
+static uint8_t nextSnr = 0;
+static int measures = 0;
+
+static const char *hookBand(const char *name)
+{
+  if(!strcmp(name, "NONE")) return("No such band");
+  trace += std::string("band ") + name + "|";
+  return(NULL);
+}
+
+static const char *hookMode(const char *name)
+{
+  trace += std::string("mode ") + name + "|";
+  return(NULL);
+}
+
+static const char *hookTune(uint32_t freqHz)
+{
+  trace += "tune " + std::to_string(freqHz) + "|";
+  return(NULL);
+}
+
+static void hookMeasure(uint8_t *rssi, uint8_t *snr)
+{
+  *rssi = nextRssi++;
+  *snr  = nextSnr;
+  measures++;
+  trace += "measure|";
+}
+
+static void hookLog(const char *text, uint8_t rssi, uint8_t snr)
+{
+  trace += std::string("log ") + text + " " + std::to_string(rssi) + " " + std::to_string(snr) + "|";
+}
+
+static void hookRestore() { trace += "restore|"; }
+static uint32_t hookMillis() { return(now); }
+
+static const ScriptHooks hooks =
+{
+  hookBand, hookMode, hookTune, hookMeasure, hookLog, hookRestore, hookMillis
+};
+
+static ScriptProgram program;
+static ScriptVM vm;
+
+// Compile the script and start it with a clean trace
+static bool load(const char *text)
+{
+  trace.clear();
+  now = nextRssi = nextSnr = measures = 0;
+  if(!scriptCompile(&program, &vm, text, strlen(text))) return(false);
+  scriptStart(&vm);
+  return(true);
+}
+
+// Step the script until it ends or the step limit, return steps taken
+static int run(int limit = 1000)
+{
+  int steps;
+  for(steps=1 ; steps<=limit && scriptStep(&vm, &program, &hooks) == SCRIPT_RUNNING ; steps++);
+  return(steps);
+}
+
+//
+// Tests
+//
+
+static void testSequence()
+{
+  int before = failed;
+
+  // Comments, blank lines, CRLF, case, and whitespace are accepted
+  CHECK("sequence", load("# Test\nBAND 40M\r\nmode usb\n\n  tune 7074000 # FT8\nlog hello  world \nrestore\n"));
+  CHECK("sequence", program.size == 5);
+
+  // One radio action per step, then one more to find the end
+  CHECK("sequence", run() == 6);
+  CHECK("sequence", vm.status == SCRIPT_DONE);
+  CHECK("sequence", trace == "band 40M|mode usb|tune 7074000|log hello  world 0 0|restore|");
+
+  // Finished script stays finished, restarting runs it again
+  CHECK("sequence", scriptStep(&vm, &program, &hooks) == SCRIPT_DONE);
+  trace.clear();
+  scriptStart(&vm);
+  run();
+  CHECK("sequence", trace == "band 40M|mode usb|tune 7074000|log hello  world 0 0|restore|");
+
+  // Nothing loaded
+  ScriptVM idle;
+  CHECK("sequence", scriptStep(&idle, &program, &hooks) == SCRIPT_IDLE);
+
+  // Stop ends the script early
+  CHECK("sequence", load("tune 1\nstop\ntune 2\n"));
+  run();
+  CHECK("sequence", vm.status == SCRIPT_DONE);
+  CHECK("sequence", trace == "tune 1|");
+
+  printf("%-16s %s\n", "sequence", failed > before ? "FAILED" : "OK");
+}
+
+static void testLoops()
+{
+  int before = failed;
+
+  CHECK("loops", load("repeat 3\n  tune 1\nend\ntune 2\n"));
+  run();
+  CHECK("loops", trace == "tune 1|tune 1|tune 1|tune 2|");
+
+  // Inner loop restarts on every outer pass
+  CHECK("loops", load("repeat 2\n  repeat 3\n    tune 1\n  end\n  tune 2\nend\n"));
+  run();
+  CHECK("loops", trace == "tune 1|tune 1|tune 1|tune 2|tune 1|tune 1|tune 1|tune 2|");
+
+  // Loops nested to the limit
+  std::string text;
+  for(int j=0 ; j<SCRIPT_MAX_DEPTH ; j++) text += "repeat 2\n";
+  text += "tune 1\n";
+  for(int j=0 ; j<SCRIPT_MAX_DEPTH ; j++) text += "end\n";
+  CHECK("loops", load(text.c_str()));
+  run(10000);
+  CHECK("loops", vm.status == SCRIPT_DONE);
+  CHECK("loops", trace.size() == (1 << SCRIPT_MAX_DEPTH) * strlen("tune 1|"));
+
+  // Forever loop, left by stop
+  CHECK("loops", load("repeat\n  measure\n  if rssi >= 4\n    stop\n  end\nend\n"));
+  run();
+  CHECK("loops", vm.status == SCRIPT_DONE);
+  CHECK("loops", measures == 5);
+
+  // Empty loop still counts its passes
+  CHECK("loops", load("repeat 5\nend\ntune 1\n"));
+  run();
+  CHECK("loops", trace == "tune 1|");
+
+  printf("%-16s %s\n", "loops", failed > before ? "FAILED" : "OK");
+}
+
+static void testConditions()
+{
+  int before = failed;
+  static const struct { const char *cmp; bool below, equal, above; } cmps[] =
+  {
+    { "<",  true,  false, false },
+    { "<=", true,  true,  false },
+    { ">",  false, false, true  },
+    { ">=", false, true,  true  },
+    { "==", false, true,  false },
+    { "!=", true,  false, true  },
+  };
+
+  // Every comparison, below, at, and above the value
+  for(unsigned int j=0 ; j<sizeof(cmps)/sizeof(cmps[0]) ; j++)
+  {
+    std::string text = std::string("measure\nif snr ") + cmps[j].cmp + " 10\n  log yes\nelse\n  log no\nend\n";
+    bool expected[] = { cmps[j].below, cmps[j].equal, cmps[j].above };
+
+    for(int k=0 ; k<3 ; k++)
+    {
+      CHECK("conditions", load(text.c_str()));
+      nextSnr = 9 + k;
+      run();
+      CHECK("conditions", trace == std::string("measure|log ") + (expected[k] ? "yes " : "no ") + "0 " + std::to_string(9 + k) + "|");
+    }
+  }
+
+  // If without else, nested in a loop, on the last reading
+  CHECK("conditions", load("repeat 4\n  measure\n  if rssi != 2\n    log x\n  end\nend\n"));
+  run();
+  CHECK("conditions", trace == "measure|log x 0 0|measure|log x 1 0|measure|measure|log x 3 0|");
+
+  // Nested if and else
+  static const char nested[] =
+    "measure\n"
+    "if rssi > 10\n"
+    "  if snr > 10\n    log both\n  else\n    log rssi\n  end\n"
+    "else\n"
+    "  if snr > 10\n    log snr\n  else\n    log none\n  end\n"
+    "end\n"
+    "log end\n";
+  static const struct { uint8_t rssi, snr; const char *log; } cases[] =
+  {
+    { 20, 20, "both" }, { 20, 5, "rssi" }, { 5, 20, "snr" }, { 5, 5, "none" },
+  };
+
+  for(unsigned int j=0 ; j<sizeof(cases)/sizeof(cases[0]) ; j++)
+  {
+    CHECK("conditions", load(nested));
+    nextRssi = cases[j].rssi;
+    nextSnr  = cases[j].snr;
+    run();
+    std::string values = " " + std::to_string(cases[j].rssi) + " " + std::to_string(cases[j].snr) + "|";
+    CHECK("conditions", trace == "measure|log " + std::string(cases[j].log) + values + "log end" + values);
+  }
+
+  printf("%-16s %s\n", "conditions", failed > before ? "FAILED" : "OK");
+}
+
+static void testWait()
+{
+  int before = failed;
+
+  CHECK("wait", load("tune 1\nwait 2s\ntune 2\nwait 1m\nwait 0\ntune 3\nwait 5ms\nwait 7\n"));
+  CHECK("wait", scriptStep(&vm, &program, &hooks) == SCRIPT_RUNNING);
+  CHECK("wait", scriptStep(&vm, &program, &hooks) == SCRIPT_RUNNING);
+  now = 1999;
+  CHECK("wait", scriptStep(&vm, &program, &hooks) == SCRIPT_RUNNING);
+  CHECK("wait", trace == "tune 1|");
+  now = 2000;
+  scriptStep(&vm, &program, &hooks);
+  CHECK("wait", trace == "tune 1|tune 2|");
+
+  // Zero wait does not pause
+  scriptStep(&vm, &program, &hooks);
+  now += 60000;
+  scriptStep(&vm, &program, &hooks);
+  CHECK("wait", trace == "tune 1|tune 2|tune 3|");
+
+  // Units, milliseconds are the default
+  CHECK("wait", program.code[1].arg == 2000);
+  CHECK("wait", program.code[3].arg == 60000);
+  CHECK("wait", program.code[6].arg == 5);
+  CHECK("wait", program.code[7].arg == 7);
+
+  printf("%-16s %s\n", "wait", failed > before ? "FAILED" : "OK");
+}
+
+static void testStepBound()
+{
+  int before = failed;
+
+  // Busy forever loop gives control back after every step
+  CHECK("step bound", load("repeat\nend\n"));
+  for(int j=0 ; j<100 ; j++)
+    CHECK("step bound", scriptStep(&vm, &program, &hooks) == SCRIPT_RUNNING);
+  CHECK("step bound", vm.depth == 1);
+
+  // REPEAT, then two instructions per pass, so the tune is the
+  // 1 + 2 * passes + 1st instruction, reached in the step it falls into
+  for(int passes=1 ; passes<=40 ; passes++)
+  {
+    std::string text = "repeat " + std::to_string(passes) + "\n  wait 0\nend\ntune 1\n";
+    CHECK("step bound", load(text.c_str()));
+
+    int steps = 0;
+    while(trace.empty() && steps < 100)
+    {
+      scriptStep(&vm, &program, &hooks);
+      steps++;
+    }
+
+    int position = 1 + 2 * passes + 1;
+    CHECK("step bound", steps == (position + SCRIPT_STEP_COUNT - 1) / SCRIPT_STEP_COUNT);
+  }
+
+  printf("%-16s %s\n", "step bound", failed > before ? "FAILED" : "OK");
+}
+
+static void testErrors()
+{
+  int before = failed;
+  static const struct { const char *text; uint16_t line; const char *error; } cases[] =
+  {
+    { "bogus\n",                        1, "Unknown command" },
+    { "tune 1\nband\n",                 2, "Expected a name" },
+    { "band 40 M\n",                    1, "Expected a name" },
+    { "tune 0\n",                       1, "Invalid frequency" },
+    { "tune 7074k\n",                   1, "Invalid frequency" },
+    { "tune 4294967296\n",              1, "Invalid frequency" },
+    { "wait 5x\n",                      1, "Invalid time" },
+    { "wait\n",                         1, "Invalid time" },
+    { "wait 71583m\n",                  1, "Invalid time" },
+    { "measure now\n",                  1, "Unexpected argument" },
+    { "repeat 0\nend\n",                1, "Invalid count" },
+    { "repeat -1\nend\n",               1, "Invalid count" },
+    { "if volume > 3\nend\n",           1, "Expected rssi or snr" },
+    { "if rssi => 3\nend\n",            1, "Invalid comparison" },
+    { "if rssi >\nend\n",               1, "Invalid value" },
+    { "if rssi > 3 4\nend\n",           1, "Invalid value" },
+    { "else\n",                         1, "Else without if" },
+    { "repeat\nelse\nend\n",            2, "Else without if" },
+    { "if snr > 1\nelse\nelse\nend\n",  3, "Else without if" },
+    { "end\n",                          1, "End without block" },
+    { "repeat 2\nend 2\n",              2, "Unexpected argument" },
+    { "repeat\n  if rssi > 1\nend\n",   1, "Block without end" },
+  };
+
+  for(unsigned int j=0 ; j<sizeof(cases)/sizeof(cases[0]) ; j++)
+  {
+    bool ok = !load(cases[j].text) && vm.status == SCRIPT_ERROR &&
+      vm.errorLine == cases[j].line && vm.error && !strcmp(vm.error, cases[j].error);
+    if(!ok) printf("%-16s FAILED \"%s\": line %u, %s\n", "errors", cases[j].text, vm.errorLine, vm.error ? vm.error : "no error");
+    CHECK("errors", ok);
+  }
+
+  // Limits of the program
+  std::string text;
+  for(int j=0 ; j<=SCRIPT_MAX_DEPTH ; j++) text += "repeat\n";
+  CHECK("errors", !load(text.c_str()) && vm.errorLine == SCRIPT_MAX_DEPTH + 1 && !strcmp(vm.error, "Blocks are nested too deep"));
+
+  text.clear();
+  for(int j=0 ; j<=SCRIPT_MAX_CODE ; j++) text += "measure\n";
+  CHECK("errors", !load(text.c_str()) && vm.errorLine == SCRIPT_MAX_CODE + 1 && !strcmp(vm.error, "Script is too long"));
+
+  text.clear();
+  for(int j=0 ; j<=SCRIPT_POOL_SIZE / 64 ; j++) text += "log " + std::string(63, 'a') + "\n";
+  CHECK("errors", !load(text.c_str()) && vm.errorLine == SCRIPT_POOL_SIZE / 64 + 1 && !strcmp(vm.error, "Script is too long"));
+
+  text = "tune 1\nlog " + std::string(200, 'a') + "\n";
+  CHECK("errors", !load(text.c_str()) && vm.errorLine == 2 && !strcmp(vm.error, "Line is too long"));
+
+  // Failed compile does not run
+  CHECK("errors", scriptStep(&vm, &program, &hooks) == SCRIPT_ERROR);
+
+  // Runtime error stops the script at the failing line
+  CHECK("errors", load("tune 1\n\nband NONE\ntune 2\n"));
+  run();
+  CHECK("errors", vm.status == SCRIPT_ERROR);
+  CHECK("errors", vm.errorLine == 3);
+  CHECK("errors", vm.error && !strcmp(vm.error, "No such band"));
+  CHECK("errors", trace == "tune 1|");
+
+  printf("%-16s %s\n", "errors", failed > before ? "FAILED" : "OK");
+}
+
+int main()
+{
+  testSequence();
+  testLoops();
+  testConditions();
+  testWait();
+  testStepBound();
+  testErrors();
+
+  if(failed)
+    fprintf(stderr, "%d of %d checks failed\n", failed, checks);
+
+  return(failed ? 1 : 0);
+}
@@ -0,0 +1,357 @@
+#include "TFT_eSPI.h"
+
+// Orbitron is about as tall as font 4, but wider
+const GFXfont Orbitron_Light_24 = { 16, 24 };
+
+//
+// Classic 5x7 GLCD font for characters 0x20-0x7E, five columns
+// per character, least significant bit at the top
+//
+static const uint8_t glcdFont[][5] =
+{
+  { 0x00, 0x00, 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x5F, 0x00, 0x00 },
+  { 0x00, 0x07, 0x00, 0x07, 0x00 }, { 0x14, 0x7F, 0x14, 0x7F, 0x14 },
+  { 0x24, 0x2A, 0x7F, 0x2A, 0x12 }, { 0x23, 0x13, 0x08, 0x64, 0x62 },
+  { 0x36, 0x49, 0x56, 0x20, 0x50 }, { 0x00, 0x08, 0x07, 0x03, 0x00 },
+  { 0x00, 0x1C, 0x22, 0x41, 0x00 }, { 0x00, 0x41, 0x22, 0x1C, 0x00 },
+  { 0x2A, 0x1C, 0x7F, 0x1C, 0x2A }, { 0x08, 0x08, 0x3E, 0x08, 0x08 },
+  { 0x00, 0x80, 0x70, 0x30, 0x00 }, { 0x08, 0x08, 0x08, 0x08, 0x08 },
+  { 0x00, 0x00, 0x60, 0x60, 0x00 }, { 0x20, 0x10, 0x08, 0x04, 0x02 },
+  { 0x3E, 0x51, 0x49, 0x45, 0x3E }, { 0x00, 0x42, 0x7F, 0x40, 0x00 },
+  { 0x72, 0x49, 0x49, 0x49, 0x46 }, { 0x21, 0x41, 0x49, 0x4D, 0x33 },
+  { 0x18, 0x14, 0x12, 0x7F, 0x10 }, { 0x27, 0x45, 0x45, 0x45, 0x39 },
+  { 0x3C, 0x4A, 0x49, 0x49, 0x31 }, { 0x41, 0x21, 0x11, 0x09, 0x07 },
+  { 0x36, 0x49, 0x49, 0x49, 0x36 }, { 0x46, 0x49, 0x49, 0x29, 0x1E },
+  { 0x00, 0x00, 0x14, 0x00, 0x00 }, { 0x00, 0x40, 0x34, 0x00, 0x00 },
+  { 0x00, 0x08, 0x14, 0x22, 0x41 }, { 0x14, 0x14, 0x14, 0x14, 0x14 },
+  { 0x00, 0x41, 0x22, 0x14, 0x08 }, { 0x02, 0x01, 0x59, 0x09, 0x06 },
+  { 0x3E, 0x41, 0x5D, 0x59, 0x4E }, { 0x7C, 0x12, 0x11, 0x12, 0x7C },
+  { 0x7F, 0x49, 0x49, 0x49, 0x36 }, { 0x3E, 0x41, 0x41, 0x41, 0x22 },
+  { 0x7F, 0x41, 0x41, 0x41, 0x3E }, { 0x7F, 0x49, 0x49, 0x49, 0x41 },
+  { 0x7F, 0x09, 0x09, 0x09, 0x01 }, { 0x3E, 0x41, 0x41, 0x51, 0x73 },
+  { 0x7F, 0x08, 0x08, 0x08, 0x7F }, { 0x00, 0x41, 0x7F, 0x41, 0x00 },
+  { 0x20, 0x40, 0x41, 0x3F, 0x01 }, { 0x7F, 0x08, 0x14, 0x22, 0x41 },
+  { 0x7F, 0x40, 0x40, 0x40, 0x40 }, { 0x7F, 0x02, 0x1C, 0x02, 0x7F },
+  { 0x7F, 0x04, 0x08, 0x10, 0x7F }, { 0x3E, 0x41, 0x41, 0x41, 0x3E },
+  { 0x7F, 0x09, 0x09, 0x09, 0x06 }, { 0x3E, 0x41, 0x51, 0x21, 0x5E },
+  { 0x7F, 0x09, 0x19, 0x29, 0x46 }, { 0x26, 0x49, 0x49, 0x49, 0x32 },
+  { 0x03, 0x01, 0x7F, 0x01, 0x03 }, { 0x3F, 0x40, 0x40, 0x40, 0x3F },
+  { 0x1F, 0x20, 0x40, 0x20, 0x1F }, { 0x3F, 0x40, 0x38, 0x40, 0x3F },
+  { 0x63, 0x14, 0x08, 0x14, 0x63 }, { 0x03, 0x04, 0x78, 0x04, 0x03 },
+  { 0x61, 0x59, 0x49, 0x4D, 0x43 }, { 0x00, 0x7F, 0x41, 0x41, 0x41 },
+  { 0x02, 0x04, 0x08, 0x10, 0x20 }, { 0x00, 0x41, 0x41, 0x41, 0x7F },
+  { 0x04, 0x02, 0x01, 0x02, 0x04 }, { 0x40, 0x40, 0x40, 0x40, 0x40 },
+  { 0x00, 0x03, 0x07, 0x08, 0x00 }, { 0x20, 0x54, 0x54, 0x78, 0x40 },
+  { 0x7F, 0x28, 0x44, 0x44, 0x38 }, { 0x38, 0x44, 0x44, 0x44, 0x28 },
+  { 0x38, 0x44, 0x44, 0x28, 0x7F }, { 0x38, 0x54, 0x54, 0x54, 0x18 },
+  { 0x00, 0x08, 0x7E, 0x09, 0x02 }, { 0x18, 0xA4, 0xA4, 0x9C, 0x78 },
+  { 0x7F, 0x08, 0x04, 0x04, 0x78 }, { 0x00, 0x44, 0x7D, 0x40, 0x00 },
+  { 0x20, 0x40, 0x40, 0x3D, 0x00 }, { 0x7F, 0x10, 0x28, 0x44, 0x00 },
+  { 0x00, 0x41, 0x7F, 0x40, 0x00 }, { 0x7C, 0x04, 0x78, 0x04, 0x78 },
+  { 0x7C, 0x08, 0x04, 0x04, 0x78 }, { 0x38, 0x44, 0x44, 0x44, 0x38 },
+  { 0xFC, 0x18, 0x24, 0x24, 0x18 }, { 0x18, 0x24, 0x24, 0x18, 0xFC },
+  { 0x7C, 0x08, 0x04, 0x04, 0x08 }, { 0x48, 0x54, 0x54, 0x54, 0x24 },
+  { 0x04, 0x04, 0x3F, 0x44, 0x24 }, { 0x3C, 0x40, 0x40, 0x20, 0x7C },
+  { 0x1C, 0x20, 0x40, 0x20, 0x1C }, { 0x3C, 0x40, 0x30, 0x40, 0x3C },
+  { 0x44, 0x28, 0x10, 0x28, 0x44 }, { 0x4C, 0x90, 0x90, 0x90, 0x7C },
+  { 0x44, 0x64, 0x54, 0x4C, 0x44 }, { 0x00, 0x08, 0x36, 0x41, 0x00 },
+  { 0x00, 0x00, 0x77, 0x00, 0x00 }, { 0x00, 0x41, 0x36, 0x08, 0x00 },
+  { 0x02, 0x01, 0x02, 0x04, 0x02 },
+};
+
+//
+// Sprite memory
+//
+
+void *TFT_eSprite::createSprite(int16_t width, int16_t height, uint8_t)
+{
+  deleteSprite();
+  buffer = (uint16_t *)calloc(width * height, sizeof(uint16_t));
+  if(buffer) { w = width; h = height; }
+  return(buffer);
+}
+
+void TFT_eSprite::deleteSprite()
+{
+  free(buffer);
+  buffer = NULL;
+  w = h = 0;
+}
+
+uint16_t TFT_eSprite::readPixel(int32_t x, int32_t y) const
+{
+  return(x<0 || y<0 || x>=w || y>=h ? 0 : buffer[y * w + x]);
+}
+
+//
+// Shapes
+//
+
+void TFT_eSprite::drawPixel(int32_t x, int32_t y, uint32_t color)
+{
+  if(x>=0 && y>=0 && x<w && y<h) buffer[y * w + x] = color;
+}
+
+void TFT_eSprite::fillRect(int32_t x, int32_t y, int32_t rw, int32_t rh, uint32_t color)
+{
+  int32_t x1 = min(x + rw, (int32_t)w);
+  int32_t y1 = min(y + rh, (int32_t)h);
+
+  for(int32_t j=max(y, 0) ; j<y1 ; j++)
+    for(int32_t i=max(x, 0) ; i<x1 ; i++)
+      buffer[j * w + i] = color;
+}
+
+void TFT_eSprite::drawRect(int32_t x, int32_t y, int32_t rw, int32_t rh, uint32_t color)
+{
+  drawFastHLine(x, y, rw, color);
+  drawFastHLine(x, y + rh - 1, rw, color);
+  drawFastVLine(x, y, rh, color);
+  drawFastVLine(x + rw - 1, y, rh, color);
+}
+
+void TFT_eSprite::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color)
+{
+  int32_t dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+  int32_t dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+  int32_t err = dx + dy;
+
+  for(;;)
+  {
+    drawPixel(x0, y0, color);
+    if(x0==x1 && y0==y1) break;
+    int32_t e2 = 2 * err;
+    if(e2 >= dy) { err += dy; x0 += sx; }
+    if(e2 <= dx) { err += dx; y0 += sy; }
+  }
+}
+
+// Pixels of a rounded rectangle ring, ir < 0 fills it
+static bool inRoundRect(int32_t i, int32_t j, int32_t rw, int32_t rh, int32_t r, int32_t ir)
+{
+  // Distance from the nearest corner center, zero along the edges
+  int32_t dx = i < r ? r - i : i >= rw - r ? i - (rw - r - 1) : 0;
+  int32_t dy = j < r ? r - j : j >= rh - r ? j - (rh - r - 1) : 0;
+  int32_t d2 = dx * dx + dy * dy;
+
+  if(d2 > r * r) return(false);
+  if(ir < 0) return(true);
+
+  // Distance from the outer edge along the straight sides
+  int32_t edge = min(min(i, rw - 1 - i), min(j, rh - 1 - j));
+  return(dx && dy ? d2 >= ir * ir : edge < r - ir);
+}
+
+void TFT_eSprite::fillRoundRect(int32_t x, int32_t y, int32_t rw, int32_t rh, int32_t r, uint32_t color)
+{
+  for(int32_t j=0 ; j<rh ; j++)
+    for(int32_t i=0 ; i<rw ; i++)
+      if(inRoundRect(i, j, rw, rh, r, -1)) drawPixel(x + i, y + j, color);
+}
+
+void TFT_eSprite::drawRoundRect(int32_t x, int32_t y, int32_t rw, int32_t rh, int32_t r, uint32_t color)
+{
+  drawSmoothRoundRect(x, y, r, r - 1, rw, rh, color);
+}
+
+void TFT_eSprite::fillSmoothRoundRect(int32_t x, int32_t y, int32_t rw, int32_t rh, int32_t r, uint32_t color, uint32_t)
+{
+  fillRoundRect(x, y, rw, rh, r, color);
+}
+
+void TFT_eSprite::drawSmoothRoundRect(int32_t x, int32_t y, int32_t r, int32_t ir, int32_t rw, int32_t rh, uint32_t fg, uint32_t, uint8_t)
+{
+  for(int32_t j=0 ; j<rh ; j++)
+    for(int32_t i=0 ; i<rw ; i++)
+      if(inRoundRect(i, j, rw, rh, r, ir)) drawPixel(x + i, y + j, fg);
+}
+
+void TFT_eSprite::drawCircle(int32_t x, int32_t y, int32_t r, uint32_t color)
+{
+  for(int32_t j=-r ; j<=r ; j++)
+    for(int32_t i=-r ; i<=r ; i++)
+    {
+      int32_t d2 = i * i + j * j;
+      if(d2 <= r * r + r && d2 >= r * r - r) drawPixel(x + i, y + j, color);
+    }
+}
+
+void TFT_eSprite::fillCircle(int32_t x, int32_t y, int32_t r, uint32_t color)
+{
+  for(int32_t j=-r ; j<=r ; j++)
+    for(int32_t i=-r ; i<=r ; i++)
+      if(i * i + j * j <= r * r + r) drawPixel(x + i, y + j, color);
+}
+
+//
+// Angles start at 6 o'clock and go clockwise, as in TFT_eSPI
+//
+void TFT_eSprite::drawSmoothArc(int32_t x, int32_t y, int32_t r, int32_t ir, uint32_t startAngle, uint32_t endAngle, uint32_t fg, uint32_t, bool)
+{
+  for(int32_t j=-r ; j<=r ; j++)
+    for(int32_t i=-r ; i<=r ; i++)
+    {
+      int32_t d2 = i * i + j * j;
+      if(d2 > r * r || d2 < ir * ir) continue;
+
+      double a = atan2(-i, j) * 180.0 / M_PI;
+      if(a < 0) a += 360.0;
+
+      bool in = startAngle <= endAngle ?
+        (a >= startAngle && a <= endAngle) :
+        (a >= startAngle || a <= endAngle);
+
+      if(in) drawPixel(x + i, y + j, fg);
+    }
+}
+
+void TFT_eSprite::drawTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color)
+{
+  drawLine(x0, y0, x1, y1, color);
+  drawLine(x1, y1, x2, y2, color);
+  drawLine(x2, y2, x0, y0, color);
+}
+
+void TFT_eSprite::fillTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color)
+{
+  int32_t xmin = min(x0, min(x1, x2)), xmax = max(x0, max(x1, x2));
+  int32_t ymin = min(y0, min(y1, y2)), ymax = max(y0, max(y1, y2));
+
+  // Pixels on the same side of all three edges, including the edges
+  for(int32_t j=ymin ; j<=ymax ; j++)
+    for(int32_t i=xmin ; i<=xmax ; i++)
+    {
+      int64_t e0 = (int64_t)(x1 - x0) * (j - y0) - (int64_t)(y1 - y0) * (i - x0);
+      int64_t e1 = (int64_t)(x2 - x1) * (j - y1) - (int64_t)(y2 - y1) * (i - x1);
+      int64_t e2 = (int64_t)(x0 - x2) * (j - y2) - (int64_t)(y0 - y2) * (i - x2);
+
+      if((e0>=0 && e1>=0 && e2>=0) || (e0<=0 && e1<=0 && e2<=0))
+        drawPixel(i, j, color);
+    }
+
+  drawTriangle(x0, y0, x1, y1, x2, y2, color);
+}
+
+//
+// Text
+//
+
+// Character cell of a TFT_eSPI font number, scaled from 6x8
+GFXfont TFT_eSprite::fontCell(uint8_t font) const
+{
+  if(font == 1 && freeFont) return(*freeFont);
+
+  switch(font)
+  {
+    case 2:  return(GFXfont{ 8, 16 });
+    case 4:  return(GFXfont{ 14, 26 });
+    case 6:  return(GFXfont{ 26, 48 });
+    case 7:  return(GFXfont{ 32, 48 });
+    case 8:  return(GFXfont{ 55, 75 });
+    default: return(GFXfont{ 6, 8 });
+  }
+}
+
+static const uint8_t *glyphOf(char c)
+{
+  return(glcdFont[(c < 0x20 || c > 0x7E ? '?' : c) - 0x20]);
+}
+
+//
+// Columns of the 6x8 cell a character takes. Font 1 is monospaced,
+// the other fonts are proportional, like in TFT_eSPI.
+//
+static int glyphColumns(const uint8_t *glyph, bool mono, int *first)
+{
+  int last;
+
+  *first = 0;
+  if(mono) return(6);
+
+  for(last=4 ; last>=0 && !glyph[last] ; last--);
+  if(last < 0) return(3);
+  for(; !glyph[*first] ; (*first)++);
+  return(last - *first + 2);
+}
+
+// Scaled width of a character
+static int32_t glyphWidth(char c, const GFXfont &cell, bool mono)
+{
+  int first;
+  return(glyphColumns(glyphOf(c), mono, &first) * cell.width / 6);
+}
+
+int32_t TFT_eSprite::drawChar(char c, int32_t x, int32_t y, const GFXfont &cell, bool mono, bool fill)
+{
+  const uint8_t *glyph = glyphOf(c);
+  int first;
+  int32_t width = glyphColumns(glyph, mono, &first) * cell.width / 6;
+
+  // Sample the 6x8 cell for every pixel of the scaled character
+  for(int32_t j=0 ; j<cell.height ; j++)
+    for(int32_t i=0 ; i<width ; i++)
+    {
+      int col = first + i * 6 / cell.width;
+      int row = j * 8 / cell.height;
+      if(col < 5 && (glyph[col] & (1 << row)))
+        drawPixel(x + i, y + j, textFg);
+      else if(fill)
+        drawPixel(x + i, y + j, textBg);
+    }
+
+  return(width);
+}
+
+int16_t TFT_eSprite::textWidth(const char *str, uint8_t font)
+{
+  GFXfont cell = fontCell(font);
+  int32_t width = 0;
+
+  for(const char *p=str ; *p ; p++)
+    width += glyphWidth(*p, cell, font == 1 && !freeFont);
+
+  return(width);
+}
+
+int16_t TFT_eSprite::drawString(const char *str, int32_t x, int32_t y, uint8_t font)
+{
+  GFXfont cell = fontCell(font);
+  int16_t width = textWidth(str, font);
+
+  // Horizontal datum: left, center, right
+  switch(textDatum % 3)
+  {
+    case 1: x -= width / 2; break;
+    case 2: x -= width;     break;
+  }
+
+  // Vertical datum: top, middle, bottom
+  switch(textDatum / 3)
+  {
+    case 1: y -= cell.height / 2; break;
+    case 2: y -= cell.height;     break;
+  }
+
+  // Free fonts are drawn without background, like in TFT_eSPI
+  bool mono = font == 1 && !freeFont;
+  bool fill = (textBg != textFg) && !(font == 1 && freeFont);
+
+  for(const char *p=str ; *p ; p++)
+    x += drawChar(*p, x, y, cell, mono, fill);
+
+  return(width);
+}
+
+int16_t TFT_eSprite::drawNumber(long n, int32_t x, int32_t y, uint8_t font)
+{
+  char buf[16];
+  snprintf(buf, sizeof(buf), "%ld", n);
+  return(drawString(buf, x, y, font));
+}
+
+int16_t TFT_eSprite::drawFloat(float n, uint8_t dp, int32_t x, int32_t y, uint8_t font)
+{
+  char buf[24];
+  snprintf(buf, sizeof(buf), "%.*f", dp, n);
+  return(drawString(buf, x, y, font));
+}
@@ -0,0 +1,130 @@
+#ifndef LINUX_TFT_ESPI_H
+#define LINUX_TFT_ESPI_H
+
+//
+// TFT_eSPI stand-in drawing into a RGB565 sprite in host memory.
+// Shapes are drawn without anti-aliasing and all fonts are the
+// 5x7 GLCD font scaled to the size of the original font, so the
+// host renders show layout, not the exact look of the screen.
+//
+
+#include <Arduino.h>
+
+// Text datums
+#define TL_DATUM  0
+#define TC_DATUM  1
+#define TR_DATUM  2
+#define ML_DATUM  3
+#define MC_DATUM  4
+#define MR_DATUM  5
+#define BL_DATUM  6
+#define BC_DATUM  7
+#define BR_DATUM  8
+
+#define TFT_BLACK 0x0000
+#define TFT_WHITE 0xFFFF
+
+// Display commands, ignored by the host display
+#define ST7789_RDDID   0x04
+#define ST7789_RDDST   0x09
+#define ST7789_SLPIN   0x10
+#define ST7789_SLPOUT  0x11
+#define ST7789_DISPOFF 0x28
+#define ST7789_DISPON  0x29
+#define TFT_MADCTL     0x36
+#define TFT_MAD_MY     0x80
+#define TFT_MAD_MX     0x40
+#define TFT_MAD_MV     0x20
+#define TFT_MAD_BGR    0x08
+
+typedef struct
+{
+  uint8_t width;     // Scaled character cell width
+  uint8_t height;    // Scaled character cell height
+} GFXfont;
+
+extern const GFXfont Orbitron_Light_24;
+
+class TFT_eSPI : public Print
+{
+  public:
+    void begin() {}
+    void setRotation(uint8_t) {}
+    void invertDisplay(bool) {}
+    void writecommand(uint8_t) {}
+    void writedata(uint8_t) {}
+    uint8_t readcommand8(uint8_t, uint8_t = 0) { return(0); }
+    unsigned long readcommand32(uint8_t, uint8_t = 0) { return(0); }
+    void fillScreen(uint32_t) {}
+    void setTextSize(uint8_t) {}
+    void setTextColor(uint16_t, uint16_t = 0, bool = false) {}
+    size_t write(uint8_t) override { return(1); }
+};
+
+class TFT_eSprite : public TFT_eSPI
+{
+  public:
+    TFT_eSprite(TFT_eSPI *) {}
+    ~TFT_eSprite() { deleteSprite(); }
+
+    void *createSprite(int16_t w, int16_t h, uint8_t frames = 1);
+    void deleteSprite();
+    void *getPointer() { return(buffer); }
+    int16_t width() const { return(w); }
+    int16_t height() const { return(h); }
+    uint16_t readPixel(int32_t x, int32_t y) const;
+
+    // Number of frames pushed to the display so far
+    uint32_t pushCount() const { return(pushes); }
+    void pushSprite(int32_t, int32_t) { pushes++; }
+    void setSwapBytes(bool) {}
+
+    void fillSprite(uint32_t color) { fillRect(0, 0, w, h, color); }
+    void drawPixel(int32_t x, int32_t y, uint32_t color);
+    void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) { fillRect(x, y, w, 1, color); }
+    void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) { fillRect(x, y, 1, h, color); }
+    void drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color);
+    void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    void fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color);
+    void drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color);
+    void fillSmoothRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color, uint32_t bg = 0x00FFFFFF);
+    void drawSmoothRoundRect(int32_t x, int32_t y, int32_t r, int32_t ir, int32_t w, int32_t h, uint32_t fg, uint32_t bg = 0x00FFFFFF, uint8_t quadrants = 0xF);
+    void drawCircle(int32_t x, int32_t y, int32_t r, uint32_t color);
+    void fillCircle(int32_t x, int32_t y, int32_t r, uint32_t color);
+    void drawSmoothArc(int32_t x, int32_t y, int32_t r, int32_t ir, uint32_t startAngle, uint32_t endAngle, uint32_t fg, uint32_t bg, bool roundEnds = false);
+    void drawTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color);
+    void fillTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color);
+
+    void setTextColor(uint16_t fg) { textFg = textBg = fg; }
+    void setTextColor(uint16_t fg, uint16_t bg, bool = false) { textFg = fg; textBg = bg; }
+    void setTextDatum(uint8_t datum) { textDatum = datum; }
+    void setTextFont(uint8_t font) { textFont = font; freeFont = NULL; }
+    void setFreeFont(const GFXfont *font) { textFont = 1; freeFont = font; }
+
+    int16_t textWidth(const char *str, uint8_t font);
+    int16_t textWidth(const char *str) { return(textWidth(str, textFont)); }
+    int16_t drawString(const char *str, int32_t x, int32_t y, uint8_t font);
+    int16_t drawString(const char *str, int32_t x, int32_t y) { return(drawString(str, x, y, textFont)); }
+    int16_t drawNumber(long n, int32_t x, int32_t y, uint8_t font);
+    int16_t drawNumber(long n, int32_t x, int32_t y) { return(drawNumber(n, x, y, textFont)); }
+    int16_t drawFloat(float n, uint8_t dp, int32_t x, int32_t y, uint8_t font);
+    int16_t drawFloat(float n, uint8_t dp, int32_t x, int32_t y) { return(drawFloat(n, dp, x, y, textFont)); }
+
+  private:
+    uint16_t *buffer = NULL;
+    int16_t w = 0;
+    int16_t h = 0;
+    uint32_t pushes = 0;
+
+    uint16_t textFg = TFT_WHITE;
+    uint16_t textBg = TFT_WHITE;
+    uint8_t textDatum = TL_DATUM;
+    uint8_t textFont = 1;
+    const GFXfont *freeFont = NULL;
+
+    GFXfont fontCell(uint8_t font) const;
+    int32_t drawChar(char c, int32_t x, int32_t y, const GFXfont &cell, bool mono, bool fill);
+};
+
+#endif // LINUX_TFT_ESPI_H
@@ -0,0 +1,13 @@
+#ifndef LINUX_CBUF_H
+#define LINUX_CBUF_H
+
+#include <stddef.h>
+
+// Only declared by the BLE headers, the BLE modules are not built
+class cbuf
+{
+  public:
+    cbuf(size_t) {}
+};
+
+#endif // LINUX_CBUF_H
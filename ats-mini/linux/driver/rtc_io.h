@@ -0,0 +1,14 @@
+#ifndef LINUX_RTC_IO_H
+#define LINUX_RTC_IO_H
+
+// The host does not sleep
+typedef int gpio_num_t;
+
+static inline void rtc_gpio_pullup_en(gpio_num_t) {}
+static inline void rtc_gpio_pullup_dis(gpio_num_t) {}
+static inline void rtc_gpio_pulldown_dis(gpio_num_t) {}
+static inline void rtc_gpio_deinit(gpio_num_t) {}
+static inline void esp_sleep_enable_ext0_wakeup(gpio_num_t, int) {}
+static inline void esp_light_sleep_start() {}
+
+#endif // LINUX_RTC_IO_H
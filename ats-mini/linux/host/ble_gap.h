@@ -0,0 +1,13 @@
+#ifndef LINUX_BLE_GAP_H
+#define LINUX_BLE_GAP_H
+
+#include <stdint.h>
+
+#define BLE_HS_CONN_HANDLE_NONE 0xFFFF
+
+struct ble_gap_conn_desc
+{
+  uint16_t conn_handle;
+};
+
+#endif // LINUX_BLE_GAP_H
@@ -0,0 +1,22 @@
+#ifndef LINUX_NVS_H
+#define LINUX_NVS_H
+
+#include <stddef.h>
+
+typedef struct
+{
+  size_t used_entries;
+  size_t free_entries;
+  size_t total_entries;
+} nvs_stats_t;
+
+// NVS usage shown in the About screen
+static inline int nvs_get_stats(const char *, nvs_stats_t *stats)
+{
+  stats->used_entries  = 120;
+  stats->free_entries  = 380;
+  stats->total_entries = 500;
+  return(0);
+}
+
+#endif // LINUX_NVS_H
@@ -0,0 +1,25 @@
+// Live values of the status page, the receiver sends all values
+// first, then only the values that change
+var radio = {};
+function show(id, text)
+{
+  var e = document.getElementById(id);
+  if(e) e.textContent = text;
+}
+function update(v)
+{
+  for(var k in v) radio[k] = v[k];
+  var freq = radio.mode == 'FM' ? (radio.frequency / 1000000).toFixed(2) + 'MHz' : (radio.frequency / 1000).toFixed(2) + 'kHz';
+  show('band', radio.band);
+  show('freq', freq + ' ' + radio.mode);
+  show('rssi', radio.rssi + 'dBuV');
+  show('snr', radio.snr + 'dB');
+  show('battery', radio.battery.toFixed(2) + 'V');
+}
+function connect()
+{
+  var ws = new WebSocket('ws://' + location.host + '/ws/status');
+  ws.onmessage = function(e) { update(JSON.parse(e.data)); };
+  ws.onclose = function() { setTimeout(connect, 2000); };
+}
+connect();
@@ -0,0 +1,287 @@
+#!/usr/bin/env python3
+"""Control an ATS Mini over the binary remote protocol.
+
+Set Settings -> USB Port to "Binary" on the receiver, then run e.g.:
+
+  atsctl.py /dev/ttyACM0 status
+  atsctl.py /dev/ttyACM0 freq 7074000
+  atsctl.py /dev/ttyACM0 key V
+  atsctl.py /dev/ttyACM0 mem-get 5
+  atsctl.py /dev/ttyACM0 watch --rate 50 time rssi snr
+  atsctl.py /dev/ttyACM0 mem-export memories.csv
+  atsctl.py /dev/ttyACM0 script-put sweep.txt
+  atsctl.py /dev/ttyACM0 script-run sweep
+"""
+
+import argparse
+import os
+import select
+import struct
+import sys
+import time
+
+from screenshot import Port, crc16
+
+SLIP_END = 0xC0
+SLIP_ESC = 0xDB
+SLIP_ESC_END = 0xDC
+SLIP_ESC_ESC = 0xDD
+
+PING = 0x01
+GET_STATUS = 0x02
+KEY = 0x03
+SET_FREQ = 0x04
+GET_MEMORY = 0x05
+SET_MEMORY = 0x06
+SUBSCRIBE = 0x07
+MEM_EXPORT = 0x08
+MEM_IMPORT = 0x09
+SCRIPT_PUT = 0x0A
+SCRIPT_RUN = 0x0B
+TELEMETRY = 0x40
+REPLY = 0x80
+ERROR = 0xFF
+
+# Requests that must not be applied twice are sent only once,
+# a lost reply does not tell whether the receiver got them
+NO_RETRY = (KEY, MEM_IMPORT, SCRIPT_PUT, SCRIPT_RUN)
+
+STATUS_FIELDS = (
+    "version frequency calibration band mode step bandwidth "
+    "agc volume rssi snr antenna_cap battery_mv"
+).split()
+STATUS_FORMAT = "<HIhBBBBbBBBHH"
+
+# Memory record: frequency (Hz), band index, mode, name
+MEMORY_FORMAT = "<IBB10s"
+MEMORY_SIZE = struct.calcsize(MEMORY_FORMAT)
+
+# Telemetry fields in record order: (name, struct format)
+TELEMETRY_FIELDS = (
+    ("time", "I"),
+    ("freq", "H"),
+    ("bfo", "h"),
+    ("rssi", "B"),
+    ("snr", "B"),
+    ("pilot", "B"),
+    ("mute", "B"),
+)
+
+
+class RemoteError(Exception):
+    def __init__(self, code, message):
+        super().__init__("error %d: %s" % (code, message))
+        self.code = code
+
+
+def slip_encode(data):
+    data = data.replace(bytes([SLIP_ESC]), bytes([SLIP_ESC, SLIP_ESC_ESC]))
+    data = data.replace(bytes([SLIP_END]), bytes([SLIP_ESC, SLIP_ESC_END]))
+    return bytes([SLIP_END]) + data + bytes([SLIP_END])
+
+
+def slip_decode(data):
+    data = data.replace(bytes([SLIP_ESC, SLIP_ESC_END]), bytes([SLIP_END]))
+    return data.replace(bytes([SLIP_ESC, SLIP_ESC_ESC]), bytes([SLIP_ESC]))
+
+
+class Client:
+    """Send requests and match replies by request id."""
+
+    def __init__(self, port, timeout=1.0, retries=3):
+        self.port = port
+        self.timeout = timeout
+        self.retries = retries
+        self.next_id = int(time.time()) & 0xFFFF
+        self.pending = b""
+
+    def read_frame(self, deadline):
+        while True:
+            if bytes([SLIP_END]) in self.pending:
+                raw, self.pending = self.pending.split(bytes([SLIP_END]), 1)
+                if raw:
+                    return slip_decode(raw)
+                continue
+            left = deadline - time.monotonic()
+            if left <= 0:
+                return None
+            ready, _, _ = select.select([self.port.fd], [], [], left)
+            if ready:
+                self.pending += os.read(self.port.fd, 512)
+
+    def telemetry(self, deadline):
+        """Return the next telemetry record as (seqnum, {field: value})."""
+        while True:
+            frame = self.read_frame(deadline)
+            if frame is None:
+                return None
+            if len(frame) < 7 or crc16(frame[:-2]) != struct.unpack("<H", frame[-2:])[0]:
+                continue
+            seqnum, opcode, mask = struct.unpack("<HBH", frame[:5])
+            if opcode != TELEMETRY:
+                continue
+            fields = [f for i, f in enumerate(TELEMETRY_FIELDS) if mask & (1 << i)]
+            values = struct.unpack("<" + "".join(f for _, f in fields), frame[5:-2])
+            return seqnum, dict(zip((n for n, _ in fields), values))
+
+    def request(self, opcode, payload=b""):
+        # Retries keep the id, so a late reply still matches
+        self.next_id = (self.next_id + 1) & 0xFFFF
+        message = struct.pack("<HB", self.next_id, opcode) + payload
+        message = slip_encode(message + struct.pack("<H", crc16(message)))
+
+        for _ in range(1 if opcode in NO_RETRY else self.retries):
+            self.port.write(message)
+
+            deadline = time.monotonic() + self.timeout
+            while True:
+                frame = self.read_frame(deadline)
+                if frame is None:
+                    break
+                if len(frame) < 5 or crc16(frame[:-2]) != struct.unpack("<H", frame[-2:])[0]:
+                    continue
+                reply_id, reply_op = struct.unpack("<HB", frame[:3])
+                if reply_id != self.next_id or reply_op == TELEMETRY:
+                    continue
+                body = frame[3:-2]
+                if reply_op == ERROR:
+                    raise RemoteError(body[0], body[1:].decode(errors="replace"))
+                if reply_op != opcode | REPLY:
+                    raise ValueError("unexpected reply opcode 0x%02X" % reply_op)
+                return body
+        raise TimeoutError("no reply from the receiver")
+
+
+def mem_export(client, path):
+    data = client.request(MEM_EXPORT)
+    used = 0
+    with open(path, "w") as f:
+        f.write("slot,freq,band,mode,name\n")
+        for slot in range(data[0]):
+            hz, band, mode, name = struct.unpack_from(MEMORY_FORMAT, data, 1 + slot * MEMORY_SIZE)
+            if not hz:
+                continue
+            name = name.split(b"\0", 1)[0].decode(errors="replace")
+            f.write("%d,%d,%d,%d,%s\n" % (slot + 1, hz, band, mode, name))
+            used += 1
+    print("%d of %d slots exported" % (used, data[0]))
+
+
+def mem_import(client, path):
+    # Slots missing from the file are cleared
+    count = client.request(MEM_EXPORT)[0]
+    table = [struct.pack(MEMORY_FORMAT, 0, 0, 0, b"")] * count
+    with open(path) as f:
+        for line in f.read().splitlines()[1:]:
+            if not line.strip():
+                continue
+            slot, hz, band, mode, name = line.split(",", 4)
+            table[int(slot) - 1] = struct.pack(MEMORY_FORMAT, int(hz), int(band), int(mode), name.encode()[:9])
+
+    start = time.monotonic()
+    changed = client.request(MEM_IMPORT, bytes([count]) + b"".join(table))[0]
+    print("%d slots changed in %.2fs" % (changed, time.monotonic() - start))
+
+
+def watch(client, rate, names):
+    names = names or [n for n, _ in TELEMETRY_FIELDS]
+    mask = sum(1 << i for i, (n, _) in enumerate(TELEMETRY_FIELDS) if n in names)
+    client.request(SUBSCRIBE, struct.pack("<BH", rate, mask))
+    expected = None
+    try:
+        while True:
+            record = client.telemetry(time.monotonic() + 2.0)
+            if record is None:
+                raise TimeoutError("telemetry stopped")
+            seqnum, values = record
+            if expected is not None and seqnum != expected:
+                print("# lost %d records" % ((seqnum - expected) & 0xFFFF), file=sys.stderr)
+            expected = (seqnum + 1) & 0xFFFF
+            print(",".join(str(values[n]) for n in names if n in values), flush=True)
+    except KeyboardInterrupt:
+        pass
+    finally:
+        client.request(SUBSCRIBE, struct.pack("<BH", 0, 0))
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter
+    )
+    parser.add_argument("port", help="serial port, e.g. /dev/ttyACM0")
+    parser.add_argument("--timeout", type=float, default=1.0, help="reply timeout (s)")
+    commands = parser.add_subparsers(dest="command", required=True)
+    commands.add_parser("ping", help="get firmware version")
+    commands.add_parser("status", help="show receiver status")
+    cmd = commands.add_parser("key", help="send an ad hoc input command, e.g. R or V")
+    cmd.add_argument("key")
+    cmd = commands.add_parser("freq", help="tune within the current band")
+    cmd.add_argument("hz", type=int)
+    cmd = commands.add_parser("mem-get", help="show a memory slot")
+    cmd.add_argument("slot", type=int)
+    cmd = commands.add_parser("mem-set", help="store a memory slot (zero frequency clears it)")
+    cmd.add_argument("slot", type=int)
+    cmd.add_argument("hz", type=int)
+    cmd.add_argument("band", type=int, help="band index")
+    cmd.add_argument("mode", type=int, help="mode index (0 FM, 1 LSB, 2 USB, 3 AM)")
+    cmd = commands.add_parser("mem-export", help="save all memory slots to a CSV file")
+    cmd.add_argument("file")
+    cmd = commands.add_parser("mem-import", help="replace all memory slots with a CSV file")
+    cmd.add_argument("file")
+    cmd = commands.add_parser("script-put", help="store a script file on the receiver")
+    cmd.add_argument("file")
+    cmd.add_argument("--name", help="script name (default: file name without extension)")
+    cmd = commands.add_parser("script-run", help="run a stored script")
+    cmd.add_argument("name")
+    commands.add_parser("script-stop", help="stop the running script")
+    cmd = commands.add_parser("watch", help="print telemetry records until interrupted")
+    cmd.add_argument("--rate", type=int, default=10, help="records per second (1-50)")
+    cmd.add_argument("fields", nargs="*", help="time freq bfo rssi snr pilot mute (default: all)")
+    args = parser.parse_args()
+    if args.command == "watch":
+        unknown = set(args.fields) - set(n for n, _ in TELEMETRY_FIELDS)
+        if unknown or not 1 <= args.rate <= 50:
+            parser.error("unknown telemetry fields or invalid rate")
+
+    port = Port(args.port)
+    client = Client(port, timeout=args.timeout)
+    try:
+        if args.command == "ping":
+            (version,) = struct.unpack("<H", client.request(PING))
+            print("Firmware version %d" % version)
+        elif args.command == "status":
+            values = struct.unpack(STATUS_FORMAT, client.request(GET_STATUS))
+            for name, value in zip(STATUS_FIELDS, values):
+                print("%s=%d" % (name, value))
+        elif args.command == "key":
+            client.request(KEY, args.key.encode()[:1])
+        elif args.command == "freq":
+            client.request(SET_FREQ, struct.pack("<I", args.hz))
+        elif args.command == "mem-get":
+            slot, hz, band, mode = struct.unpack("<BIBB", client.request(GET_MEMORY, bytes([args.slot])))
+            print("#%02d band=%d freq=%d mode=%d" % (slot, band, hz, mode))
+        elif args.command == "mem-set":
+            client.request(SET_MEMORY, struct.pack("<BIBB", args.slot, args.hz, args.band, args.mode))
+        elif args.command == "mem-export":
+            mem_export(client, args.file)
+        elif args.command == "mem-import":
+            mem_import(client, args.file)
+        elif args.command == "script-put":
+            name = args.name or os.path.splitext(os.path.basename(args.file))[0]
+            with open(args.file, "rb") as f:
+                client.request(SCRIPT_PUT, name.encode() + b"\0" + f.read())
+        elif args.command == "script-run":
+            client.request(SCRIPT_RUN, args.name.encode())
+        elif args.command == "script-stop":
+            client.request(SCRIPT_RUN)
+        elif args.command == "watch":
+            watch(client, args.rate, args.fields)
+    except (RemoteError, TimeoutError) as e:
+        print(e, file=sys.stderr)
+        sys.exit(1)
+    finally:
+        port.close()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,197 @@
+#!/usr/bin/env python3
+"""Capture an ATS Mini screenshot over the USB serial port and save it as BMP.
+
+By default the compressed binary capture (the "c" remote command) is used.
+The --hex option uses the original HEX capture ("C") for comparison, and
+--input decodes a previously saved binary capture instead of reading a port.
+"""
+
+import argparse
+import os
+import select
+import struct
+import sys
+import termios
+import time
+import tty
+
+MAGIC = b"ATSC"
+TIMEOUT = 10.0
+
+
+class Port:
+    """Minimal raw serial port reader based on termios (no dependencies)."""
+
+    def __init__(self, path):
+        self.fd = os.open(path, os.O_RDWR | os.O_NOCTTY)
+        self.attrs = termios.tcgetattr(self.fd)
+        tty.setraw(self.fd)
+        termios.tcflush(self.fd, termios.TCIOFLUSH)
+        self.received = 0
+
+    def close(self):
+        termios.tcsetattr(self.fd, termios.TCSANOW, self.attrs)
+        os.close(self.fd)
+
+    def write(self, data):
+        os.write(self.fd, data)
+
+    def read(self, size):
+        data = b""
+        while len(data) < size:
+            ready, _, _ = select.select([self.fd], [], [], TIMEOUT)
+            if not ready:
+                raise TimeoutError("no data from the receiver")
+            chunk = os.read(self.fd, size - len(data))
+            data += chunk
+        self.received += len(data)
+        return data
+
+    def readline(self):
+        line = b""
+        while not line.endswith(b"\n"):
+            line += self.read(1)
+        return line
+
+
+class Buffer:
+    """File-like reader over saved capture data."""
+
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+        self.received = len(data)
+
+    def read(self, size):
+        if self.pos + size > len(self.data):
+            raise EOFError("truncated capture")
+        chunk = self.data[self.pos : self.pos + size]
+        self.pos += size
+        return chunk
+
+
+def crc16(data, crc=0xFFFF):
+    """CRC-16/CCITT-FALSE, same as crc16() in the firmware."""
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def rle_decode(data, width):
+    """Decode one RLE row into big-endian RGB565 pixel bytes."""
+    out = bytearray()
+    pos = 0
+    while pos < len(data):
+        header = data[pos]
+        pos += 1
+        if header & 0x80:
+            out += data[pos : pos + 2] * ((header & 0x7F) + 2)
+            pos += 2
+        else:
+            count = (header + 1) * 2
+            out += data[pos : pos + count]
+            pos += count
+    if len(out) != width * 2:
+        raise ValueError("row decodes to %d pixels, expected %d" % (len(out) // 2, width))
+    return bytes(out)
+
+
+def read_binary(stream):
+    """Read a binary capture, return (width, height, top-down RGB565BE rows)."""
+    # Skip anything (echo, log lines) preceding the header
+    window = b""
+    while window != MAGIC:
+        window = (window + stream.read(1))[-len(MAGIC) :]
+
+    version, fmt, width, height = struct.unpack("<BBHH", stream.read(6))
+    if version != 1 or fmt != 1:
+        raise ValueError("unsupported capture version %d format %d" % (version, fmt))
+
+    rows = []
+    while True:
+        (size,) = struct.unpack("<H", stream.read(2))
+        if not size:
+            break
+        data = stream.read(size)
+        (crc,) = struct.unpack("<H", stream.read(2))
+        if crc != crc16(data):
+            raise ValueError("CRC mismatch in row %d" % len(rows))
+        rows.append(rle_decode(data, width))
+
+    if len(rows) != height:
+        raise ValueError("got %d rows, expected %d" % (len(rows), height))
+
+    return width, height, rows
+
+
+def read_hex(stream):
+    """Read a HEX capture, return the BMP file contents."""
+    line = b""
+    while not line.startswith(b"424d"):
+        line = stream.readline().strip()
+
+    header = bytes.fromhex(line.decode())
+    width, height = struct.unpack("<ii", header[18:26])
+    rows = [bytes.fromhex(stream.readline().strip().decode()) for _ in range(height)]
+    return header + b"".join(rows)
+
+
+def make_bmp(width, height, rows):
+    """Build a 16bpp BMP with RGB565 bit fields, like the HEX capture does."""
+    header_size = 14 + 40 + 12
+    image_size = width * height * 2
+    bmp = struct.pack("<2sIII", b"BM", header_size + image_size, 0, header_size)
+    bmp += struct.pack("<IiiHHIIiiII", 40, width, height, 1, 16, 3, 0, 0, 0, 0, 0)
+    bmp += struct.pack("<III", 0xF800, 0x07E0, 0x001F)
+
+    # BMP rows go bottom to top, pixels are little-endian
+    for row in reversed(rows):
+        swapped = bytearray(row)
+        swapped[0::2], swapped[1::2] = row[1::2], row[0::2]
+        bmp += swapped
+    return bmp
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("port", nargs="?", help="serial port, e.g. /dev/ttyACM0")
+    parser.add_argument("output", help="output BMP file name")
+    parser.add_argument("--hex", action="store_true", help="use the HEX capture (C command)")
+    parser.add_argument("--input", help="decode a saved binary capture instead of a port")
+    args = parser.parse_args()
+
+    if args.input:
+        with open(args.input, "rb") as f:
+            stream = Buffer(f.read())
+    elif args.port:
+        stream = Port(args.port)
+    else:
+        parser.error("either a serial port or --input is required")
+
+    start = time.monotonic()
+    try:
+        if args.input is None:
+            stream.write(b"C" if args.hex else b"c")
+        if args.hex:
+            bmp = read_hex(stream)
+        else:
+            bmp = make_bmp(*read_binary(stream))
+    finally:
+        if isinstance(stream, Port):
+            stream.close()
+    elapsed = time.monotonic() - start
+
+    with open(args.output, "wb") as f:
+        f.write(bmp)
+
+    print(
+        "%s: %d bytes received in %.2fs" % (args.output, stream.received, elapsed),
+        file=sys.stderr,
+    )
+
+
+if __name__ == "__main__":
+    main()
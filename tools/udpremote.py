@@ -0,0 +1,90 @@
+#!/usr/bin/env python3
+"""Send ad hoc remote commands to an ATS Mini over UDP and measure latency.
+
+Set the UDP remote control key on the receiver web configuration page,
+then run e.g.:
+
+  udpremote.py --key secret atsmini.local VVV
+  udpremote.py --key secret atsmini.local t --listen 5
+  udpremote.py --key secret atsmini.local --bench 200
+"""
+
+import argparse
+import socket
+import statistics
+import sys
+import time
+
+PORT = 8700
+
+
+def bench(sock, key, count):
+    """Measure round trip time of keep alive datagrams."""
+    times = []
+    lost = 0
+    for _ in range(count):
+        start = time.perf_counter()
+        sock.send(key + b"\n")
+        try:
+            while sock.recv(2048):
+                # Skip output of earlier commands, keep alive reply is empty
+                pass
+        except socket.timeout:
+            lost += 1
+            continue
+        times.append((time.perf_counter() - start) * 1000)
+
+    if not times:
+        sys.exit("no replies from the receiver")
+    print(
+        "%d sent, %d lost, round trip min/avg/max/p95 = %.1f/%.1f/%.1f/%.1f ms"
+        % (
+            count,
+            lost,
+            min(times),
+            statistics.mean(times),
+            max(times),
+            sorted(times)[max(0, int(len(times) * 0.95) - 1)],
+        )
+    )
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter
+    )
+    parser.add_argument("host", help="receiver address, e.g. atsmini.local")
+    parser.add_argument("commands", nargs="?", default="", help="ad hoc commands to send")
+    parser.add_argument("--key", required=True, help="shared key")
+    parser.add_argument("--port", type=int, default=PORT, help="UDP port")
+    parser.add_argument("--listen", type=float, default=1.0, help="seconds to print replies")
+    parser.add_argument("--bench", type=int, metavar="N", help="measure N round trips")
+    args = parser.parse_args()
+
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.connect((socket.gethostbyname(args.host), args.port))
+    sock.settimeout(1.0)
+    key = args.key.encode()
+
+    if args.bench:
+        bench(sock, key, args.bench)
+        return
+
+    # Keep alive datagrams keep the status log flowing while listening
+    sock.send(key + b"\n" + args.commands.encode())
+    end = time.monotonic() + args.listen
+    alive = time.monotonic()
+    while time.monotonic() < end:
+        if time.monotonic() - alive > 30:
+            sock.send(key + b"\n")
+            alive = time.monotonic()
+        try:
+            data = sock.recv(2048)
+        except socket.timeout:
+            continue
+        sys.stdout.write(data.decode(errors="replace"))
+        sys.stdout.flush()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,105 @@
+#!/usr/bin/env python3
+"""Compress static web UI files into a C header served from flash.
+
+Every file in ats-mini/web becomes a gzipped byte array in
+ats-mini/WebAssets.h, HTML files are served without the extension:
+
+  webassets.py
+  webassets.py --check
+"""
+
+import argparse
+import gzip
+import hashlib
+import os
+import sys
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "ats-mini")
+SOURCE = os.path.join(ROOT, "web")
+HEADER = os.path.join(ROOT, "WebAssets.h")
+
+TYPES = {
+    ".css": "text/css",
+    ".html": "text/html",
+    ".js": "application/javascript",
+}
+
+
+def compress(data):
+    # Indentation is only for humans, line breaks are kept intact
+    lines = (line.strip() for line in data.decode().splitlines())
+    text = "\n".join(line for line in lines if line) + "\n"
+    # Zero time stamp keeps the output reproducible
+    return gzip.compress(text.encode(), compresslevel=9, mtime=0)
+
+
+def symbol(name):
+    base, ext = os.path.splitext(name)
+    return "web" + "".join(p.capitalize() for p in (base + "_" + ext[1:]).replace("-", "_").split("_"))
+
+
+def generate():
+    out = [
+        "// Generated by tools/webassets.py from the web folder, do not edit",
+        "#ifndef WEB_ASSETS_H",
+        "#define WEB_ASSETS_H",
+        "",
+        "typedef struct",
+        "{",
+        "  const char *path;       // URL path",
+        "  const char *type;       // Content type",
+        "  const uint8_t *data;    // Gzipped contents",
+        "  size_t size;            // Gzipped size",
+        "  const char *etag;       // Entity tag, changes with the contents",
+        "} WebAsset;",
+        "",
+    ]
+    assets = []
+
+    for name in sorted(os.listdir(SOURCE)):
+        base, ext = os.path.splitext(name)
+        if ext not in TYPES:
+            continue
+        with open(os.path.join(SOURCE, name), "rb") as f:
+            data = compress(f.read())
+        path = "/" + (base if ext == ".html" else name)
+        assets.append((path, TYPES[ext], symbol(name), hashlib.md5(data).hexdigest()[:16]))
+
+        out.append("// %s: %d bytes" % (name, len(data)))
+        out.append("static const uint8_t %s[] PROGMEM =" % symbol(name))
+        out.append("{")
+        for i in range(0, len(data), 16):
+            out.append("  " + ", ".join("0x%02X" % b for b in data[i : i + 16]) + ",")
+        out.append("};")
+        out.append("")
+
+    out.append("static const WebAsset webAssets[] =")
+    out.append("{")
+    for path, ctype, sym, etag in assets:
+        out.append('  { "%s", "%s", %s, sizeof(%s), "\\"%s\\"" },' % (path, ctype, sym, sym, etag))
+    out.append("};")
+    out.append("")
+    out.append("#endif")
+    return "\n".join(out) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter
+    )
+    parser.add_argument("--check", action="store_true", help="fail if the header is out of date")
+    args = parser.parse_args()
+
+    text = generate()
+    if args.check:
+        with open(HEADER) as f:
+            if f.read() != text:
+                sys.exit("WebAssets.h is out of date, run tools/webassets.py")
+        return
+
+    with open(HEADER, "w") as f:
+        f.write(text)
+
+
+if __name__ == "__main__":
+    main()